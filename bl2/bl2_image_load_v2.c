@@ -18,15 +18,47 @@
 
 #include <platform_def.h>
 
+#if BL2_PIPELINED_LOAD
+/*******************************************************************************
+ * Authenticate an image whose load has been started by load_auth_image_start()
+ * and only then let the platform handle it.
+ ******************************************************************************/
+static void bl2_complete_image_load(const bl_load_info_node_t *node_info)
+{
+	int err;
+
+	err = load_auth_image_finish(node_info->image_id, node_info->image_info);
+	if (err != 0) {
+		ERROR("BL2: Failed to load image id %u (%i)\n",
+		      node_info->image_id, err);
+		plat_error_handler(err);
+	}
+
+	err = bl2_plat_handle_post_image_load(node_info->image_id);
+	if (err != 0) {
+		ERROR("BL2: Failure in post image load handling (%i)\n", err);
+		plat_error_handler(err);
+	}
+}
+#endif /* BL2_PIPELINED_LOAD */
+
 /*******************************************************************************
  * This function loads SCP_BL2/BL3x images and returns the ep_info for
  * the next executable image.
+ *
+ * With BL2_PIPELINED_LOAD, the load of each image is started before the
+ * previous one is authenticated, so that the two can overlap on platforms
+ * that read storage in the background.
  ******************************************************************************/
 struct entry_point_info *bl2_load_images(void)
 {
 	bl_params_t *bl2_to_next_bl_params;
 	bl_load_info_t *bl2_load_info;
 	const bl_load_info_node_t *bl2_node_info;
+#if BL2_PIPELINED_LOAD
+	/* Image loaded but not yet authenticated */
+	const bl_load_info_node_t *pending_node_info = NULL;
+#endif
 	int plat_setup_done = 0;
 	int err;
 
@@ -66,8 +98,26 @@ struct entry_point_info *bl2_load_images(void)
 		if ((bl2_node_info->image_info->h.attr &
 		    IMAGE_ATTRIB_SKIP_LOADING) == 0U) {
 			INFO("BL2: Loading image id %u\n", bl2_node_info->image_id);
+#if BL2_PIPELINED_LOAD
+			err = load_auth_image_start(bl2_node_info->image_id,
+				bl2_node_info->image_info);
+			if (pending_node_info != NULL) {
+				bl2_complete_image_load(pending_node_info);
+				pending_node_info = NULL;
+			}
+			if (err == 0) {
+				pending_node_info = bl2_node_info;
+				bl2_node_info = bl2_node_info->next_load_info;
+				continue;
+			}
+
+			/* Retry the plain way, which may try other boot sources */
 			err = load_auth_image(bl2_node_info->image_id,
 				bl2_node_info->image_info);
+#else
+			err = load_auth_image(bl2_node_info->image_id,
+				bl2_node_info->image_info);
+#endif /* BL2_PIPELINED_LOAD */
 			if (err != 0) {
 				ERROR("BL2: Failed to load image id %u (%i)\n",
 				      bl2_node_info->image_id, err);
@@ -75,6 +125,12 @@ struct entry_point_info *bl2_load_images(void)
 			}
 		} else {
 			INFO("BL2: Skip loading image id %u\n", bl2_node_info->image_id);
+#if BL2_PIPELINED_LOAD
+			if (pending_node_info != NULL) {
+				bl2_complete_image_load(pending_node_info);
+				pending_node_info = NULL;
+			}
+#endif
 		}
 
 		/* Allow platform to handle image information. */
@@ -88,6 +144,12 @@ struct entry_point_info *bl2_load_images(void)
 		bl2_node_info = bl2_node_info->next_load_info;
 	}
 
+#if BL2_PIPELINED_LOAD
+	if (pending_node_info != NULL) {
+		bl2_complete_image_load(pending_node_info);
+	}
+#endif
+
 	/*
 	 * Get information to pass to the next image.
 	 */
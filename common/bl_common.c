@@ -7,6 +7,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
@@ -15,6 +16,7 @@
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
 #include <drivers/io/io_storage.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
@@ -60,15 +62,88 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
 	return value;
 }
 
+#if CRYPTO_SUPPORT
+/*
+ * Size of the pieces an image is read in when it is hashed while loading, so
+ * that each piece is still in the data cache when it is hashed.
+ */
+#ifndef LOAD_IMAGE_HASH_CHUNK_SIZE
+#define LOAD_IMAGE_HASH_CHUNK_SIZE	U(0x10000)
+#endif
+
+/*******************************************************************************
+ * Read an image in chunks and feed each chunk to the crypto module as soon as
+ * it lands. The digest is kept by the crypto module so that authenticating or
+ * measuring the image does not need to read it back from memory. If the crypto
+ * library cannot hash incrementally, the image is read in a single go.
+ *
+ * An encrypted image is decrypted and its tag checked by a single read of the
+ * whole payload, so it is read in one go and hashed once it is in memory.
+ ******************************************************************************/
+static int read_image_hashed(uintptr_t dev_handle, uintptr_t image_handle,
+			     uintptr_t image_base, size_t image_size,
+			     size_t *bytes_read)
+{
+	size_t offset = 0U;
+	size_t chunk_max = LOAD_IMAGE_HASH_CHUNK_SIZE;
+	size_t chunk;
+	size_t chunk_read;
+	bool hashing;
+	int io_result;
+
+	hashing = (crypto_mod_hash_init() == CRYPTO_SUCCESS);
+	if (!hashing) {
+		return io_read(image_handle, image_base, image_size,
+			       bytes_read);
+	}
+
+	if (io_dev_type(dev_handle) == IO_TYPE_ENCRYPTED) {
+		chunk_max = image_size;
+	}
+
+	while (offset < image_size) {
+		chunk = MIN(image_size - offset, chunk_max);
+
+		io_result = io_read(image_handle, image_base + offset, chunk,
+				    &chunk_read);
+		if (io_result != 0) {
+			break;
+		}
+
+		if (hashing && (crypto_mod_hash_update(
+				(void *)(image_base + offset),
+				(unsigned int)chunk_read) != CRYPTO_SUCCESS)) {
+			/* Carry on loading; the image gets hashed later */
+			hashing = false;
+		}
+
+		offset += chunk_read;
+		if (chunk_read < chunk) {
+			break;
+		}
+	}
+
+	*bytes_read = offset;
+
+	if (hashing && (offset == image_size)) {
+		(void)crypto_mod_hash_final();
+	}
+
+	return io_result;
+}
+#endif /* CRYPTO_SUPPORT */
+
 /*******************************************************************************
  * Internal function to load an image at a specific address given
- * an image ID and extents of free memory.
+ * an image ID and extents of free memory. If 'hash' is set and the crypto
+ * module supports it, the image is hashed while it is read.
  *
  * If the load is successful then the image information is updated.
  *
  * Returns 0 on success, a negative error code otherwise.
  ******************************************************************************/
-static int load_image(unsigned int image_id, image_info_t *image_data)
+static int load_image(unsigned int image_id, image_info_t *image_data,
+		      bool hash)
 {
 	uintptr_t dev_handle;
 	uintptr_t image_handle;
@@ -126,7 +201,20 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 
 	/* We have enough space so load the image now */
 	/* TODO: Consider whether to try to recover/retry a partially successful read */
-	io_result = io_read(image_handle, image_base, image_size, &bytes_read);
+#if CRYPTO_SUPPORT
+	/* A digest kept from an earlier load may cover the memory read here */
+	crypto_mod_clear_stream_hash();
+
+	if (hash) {
+		io_result = read_image_hashed(dev_handle, image_handle,
+					      image_base, image_size,
+					      &bytes_read);
+	} else
+#endif
+	{
+		io_result = io_read(image_handle, image_base, image_size,
+				    &bytes_read);
+	}
 	if ((io_result != 0) || (bytes_read < image_size)) {
 		WARN("Failed to load image id=%u (%i)\n", image_id, io_result);
 		goto exit;
@@ -167,8 +255,11 @@ static int load_auth_image_recursive(unsigned int image_id,
 		}
 	}
 
-	/* Load the image */
-	rc = load_image(image_id, image_data);
+	/*
+	 * Load the image. Certificates are only partly hashed when they are
+	 * authenticated, so there is no point hashing them while loading.
+	 */
+	rc = load_image(image_id, image_data, is_parent_image == 0);
 	if (rc != 0) {
 		return rc;
 	}
@@ -179,6 +270,9 @@ static int load_auth_image_recursive(unsigned int image_id,
 				 image_data->image_size);
 	if (rc != 0) {
 		/* Authentication error, zero memory and flush it right away. */
+#if CRYPTO_SUPPORT
+		crypto_mod_clear_stream_hash();
+#endif
 		zero_normalmem((void *)image_data->image_base,
 			       image_data->image_size);
 		flush_dcache_range(image_data->image_base,
@@ -199,9 +293,81 @@ static int load_auth_image_internal(unsigned int image_id,
 	}
 #endif
 
-	return load_image(image_id, image_data);
+	return load_image(image_id, image_data, true);
 }
 
+#if BL2_PIPELINED_LOAD
+/*******************************************************************************
+ * First half of a pipelined load: authenticate the parent images, then load
+ * the image itself without authenticating it. The platform may leave the image
+ * read running in the background, so the image must not be accessed until
+ * load_auth_image_finish() has been called for it. No alternate boot source is
+ * tried on failure; callers fall back to load_auth_image() for that.
+ ******************************************************************************/
+int load_auth_image_start(unsigned int image_id, image_info_t *image_data)
+{
+#if TRUSTED_BOARD_BOOT
+	unsigned int parent_id;
+	int rc;
+
+	if (dyn_is_auth_disabled() == 0) {
+		rc = auth_mod_get_parent_id(image_id, &parent_id);
+		if (rc == 0) {
+			rc = load_auth_image_recursive(parent_id, image_data, 1);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+	}
+#endif
+
+	bl2_plat_start_async_load(image_id);
+
+	/* The read may still be in flight, so it cannot be hashed as it lands */
+	return load_image(image_id, image_data, false);
+}
+
+/*******************************************************************************
+ * Second half of a pipelined load: wait for the image read started by
+ * load_auth_image_start() to land, then authenticate, measure and flush the
+ * image as load_auth_image() does.
+ ******************************************************************************/
+int load_auth_image_finish(unsigned int image_id, image_info_t *image_data)
+{
+	int err;
+
+	err = bl2_plat_wait_async_load(image_id);
+	if (err != 0) {
+		return err;
+	}
+
+#if TRUSTED_BOARD_BOOT
+	if (dyn_is_auth_disabled() == 0) {
+		err = auth_mod_verify_img(image_id,
+					  (void *)image_data->image_base,
+					  image_data->image_size);
+		if (err != 0) {
+			/* Authentication error, zero memory and flush it right away. */
+			zero_normalmem((void *)image_data->image_base,
+				       image_data->image_size);
+			flush_dcache_range(image_data->image_base,
+					   image_data->image_size);
+			return -EAUTH;
+		}
+	}
+#endif
+
+	err = plat_mboot_measure_image(image_id, image_data);
+	if (err != 0) {
+		return err;
+	}
+
+	flush_dcache_range(image_data->image_base, image_data->image_size);
+
+	return 0;
+}
+#endif /* BL2_PIPELINED_LOAD */
+
 /*******************************************************************************
  * Generic function to load and authenticate an image. The image is actually
  * loaded by calling the 'load_image()' function. Therefore, it returns the
@@ -233,6 +399,10 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		 * it (if MEASURED_BOOT flag is enabled).
 		 */
 		err = plat_mboot_measure_image(image_id, image_data);
+#if CRYPTO_SUPPORT
+		/* The digest kept while loading is not needed any more */
+		crypto_mod_clear_stream_hash();
+#endif
 		if (err != 0) {
 			return err;
 		}
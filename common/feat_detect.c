@@ -36,6 +36,19 @@ static void read_feat_csv2_2(void)
 #endif
 }
 
+/**********************************************************
+ * Feature : FEAT_SHA256/FEAT_SHA512 (SHA2 instructions)
+ *********************************************************/
+static void read_feat_sha2(void)
+{
+#if (ENABLE_FEAT_SHA256 == FEAT_STATE_1)
+	feat_detect_panic(is_armv8_0_feat_sha256_present(), "SHA256");
+#endif
+#if (ENABLE_FEAT_SHA512 == FEAT_STATE_1)
+	feat_detect_panic(is_armv8_2_feat_sha512_present(), "SHA512");
+#endif
+}
+
 /***********************************************
  * Feature : FEAT_PAN (Privileged Access Never)
  **********************************************/
@@ -261,6 +274,7 @@ void detect_arch_features(void)
 	/* v8.0 features */
 	read_feat_sb();
 	read_feat_csv2_2();
+	read_feat_sha2();
 
 	/* v8.1 features */
 	read_feat_pan();
@@ -5,18 +5,33 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdint.h>
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/image_decompress.h>
+#include <drivers/io/io_storage.h>
+#include <lib/utils_def.h>
+#include <plat/common/platform.h>
 
 static uintptr_t decompressor_buf_base;
 static uint32_t decompressor_buf_size;
 static decompressor_t *decompressor;
 static struct image_info saved_image_info;
 
+static uintptr_t stream_in_base;
+static size_t stream_in_size;
+static uintptr_t stream_work_base;
+static size_t stream_work_size;
+static stream_decompressor_t *stream_decompressor;
+
+struct stream_source {
+	uintptr_t image_handle;
+	size_t left;
+};
+
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *_decompressor)
 {
@@ -78,3 +93,96 @@ int image_decompress(struct image_info *info)
 
 	return 0;
 }
+
+void image_decompress_stream_init(uintptr_t in_base, size_t in_size,
+				  uintptr_t work_base, size_t work_size,
+				  stream_decompressor_t *_decompressor)
+{
+	stream_in_base = in_base;
+	stream_in_size = in_size;
+	stream_work_base = work_base;
+	stream_work_size = work_size;
+	stream_decompressor = _decompressor;
+}
+
+static int stream_read(void *handle, uintptr_t buf, size_t len,
+		       size_t *len_read)
+{
+	struct stream_source *src = handle;
+	int ret;
+
+	*len_read = 0U;
+	len = MIN(len, src->left);
+	if (len == 0U)
+		return 0;
+
+	ret = io_read(src->image_handle, buf, len, len_read);
+	if (ret != 0)
+		return ret;
+
+	src->left -= *len_read;
+
+	return 0;
+}
+
+/*
+ * Load a compressed image straight to info->image_base. The compressed data is
+ * read from the image's io source through the small input window as the
+ * decompressor asks for it, instead of being read in full to a temporary
+ * buffer first. The image is not authenticated on this path.
+ */
+int image_decompress_stream(unsigned int image_id, struct image_info *info)
+{
+	struct stream_source src;
+	uintptr_t dev_handle, image_spec, image_base;
+	size_t image_size;
+	int ret;
+
+	assert(stream_decompressor != NULL);
+
+	ret = plat_get_image_source(image_id, &dev_handle, &image_spec);
+	if (ret != 0) {
+		WARN("Failed to obtain reference to image id=%u (%i)\n",
+			image_id, ret);
+		return ret;
+	}
+
+	ret = io_open(dev_handle, image_spec, &src.image_handle);
+	if (ret != 0) {
+		WARN("Failed to access image id=%u (%i)\n", image_id, ret);
+		return ret;
+	}
+
+	ret = io_size(src.image_handle, &image_size);
+	if ((ret != 0) || (image_size == 0U)) {
+		WARN("Failed to determine the size of the image id=%u (%i)\n",
+			image_id, ret);
+		if (ret == 0)
+			ret = -EIO;
+		goto exit;
+	}
+
+	INFO("Loading compressed image id=%u at address 0x%lx\n", image_id,
+	     info->image_base);
+
+	src.left = image_size;
+	image_base = info->image_base;
+
+	ret = stream_decompressor(stream_read, &src,
+				  &image_base, info->image_max_size,
+				  stream_in_base, stream_in_size,
+				  stream_work_base, stream_work_size);
+	if (ret != 0) {
+		ERROR("Failed to decompress image (err=%d)\n", ret);
+		goto exit;
+	}
+
+	info->image_size = image_base - info->image_base;
+
+	flush_dcache_range(info->image_base, info->image_size);
+
+exit:
+	(void)io_close(src.image_handle);
+
+	return ret;
+}
@@ -5,9 +5,13 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
 #include <common/debug.h>
 #include <drivers/auth/crypto_mod.h>
+#include <lib/utils.h>
 
 /* Variable exported by the crypto library through REGISTER_CRYPTO_LIB() */
 
@@ -109,6 +113,97 @@ int crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
 					   digest_info_ptr, digest_info_len);
 }
 
+/*
+ * Digest of the data last streamed through crypto_mod_hash_update(), kept so
+ * that verifying or measuring the same memory range does not hash it again.
+ */
+static struct {
+	bool valid;
+	bool contiguous;
+	uintptr_t base;
+	unsigned int len;
+	enum crypto_md_algo alg;
+	unsigned char hash[CRYPTO_MD_MAX_SIZE];
+} stream_hash;
+
+/*
+ * Start hashing a memory range piece by piece, e.g. as it is loaded. Returns
+ * CRYPTO_ERR_HASH if the crypto library has no incremental hash functions.
+ */
+int crypto_mod_hash_init(void)
+{
+	zeromem(&stream_hash, sizeof(stream_hash));
+
+	if (crypto_lib_desc.hash_init == NULL) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	stream_hash.contiguous = true;
+
+	return crypto_lib_desc.hash_init();
+}
+
+/*
+ * Add data to the hash. Consecutive calls are expected to follow each other
+ * in memory; otherwise the digest is still computed but not kept.
+ */
+int crypto_mod_hash_update(void *data_ptr, unsigned int data_len)
+{
+	assert(crypto_lib_desc.hash_update != NULL);
+	assert(data_ptr != NULL);
+
+	if (stream_hash.len == 0U) {
+		stream_hash.base = (uintptr_t)data_ptr;
+	} else if ((uintptr_t)data_ptr != (stream_hash.base + stream_hash.len)) {
+		stream_hash.contiguous = false;
+	}
+	stream_hash.len += data_len;
+
+	return crypto_lib_desc.hash_update(data_ptr, data_len);
+}
+
+/* Finish the hash and keep the digest for the range it covers */
+int crypto_mod_hash_final(void)
+{
+	int rc;
+
+	assert(crypto_lib_desc.hash_final != NULL);
+
+	rc = crypto_lib_desc.hash_final(&stream_hash.alg, stream_hash.hash);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
+	stream_hash.valid = stream_hash.contiguous && (stream_hash.len != 0U);
+
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Look up the digest kept by crypto_mod_hash_final(). Returns CRYPTO_SUCCESS
+ * with the algorithm and digest if it covers exactly this memory range.
+ */
+int crypto_mod_get_stream_hash(void *data_ptr, unsigned int data_len,
+			       enum crypto_md_algo *alg,
+			       unsigned char output[CRYPTO_MD_MAX_SIZE])
+{
+	if (!stream_hash.valid || (stream_hash.base != (uintptr_t)data_ptr) ||
+	    (stream_hash.len != data_len)) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	*alg = stream_hash.alg;
+	memcpy(output, stream_hash.hash, CRYPTO_MD_MAX_SIZE);
+
+	return CRYPTO_SUCCESS;
+}
+
+/* Forget the kept digest, e.g. once the memory it covers may change */
+void crypto_mod_clear_stream_hash(void)
+{
+	stream_hash.valid = false;
+}
+
 #if MEASURED_BOOT
 /*
  * Calculate a hash
@@ -123,10 +218,18 @@ int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 			 unsigned int data_len,
 			 unsigned char output[CRYPTO_MD_MAX_SIZE])
 {
+	enum crypto_md_algo stream_alg;
+
 	assert(data_ptr != NULL);
 	assert(data_len != 0);
 	assert(output != NULL);
 
+	if ((crypto_mod_get_stream_hash(data_ptr, data_len, &stream_alg,
+					output) == CRYPTO_SUCCESS) &&
+	    (stream_alg == alg)) {
+		return CRYPTO_SUCCESS;
+	}
+
 	return crypto_lib_desc.calc_hash(alg, data_ptr, data_len, output);
 }
 #endif	/* MEASURED_BOOT */
@@ -158,6 +261,9 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 	assert(tag != NULL);
 	assert((tag_len != 0U) && (tag_len <= CRYPTO_MAX_TAG_SIZE));
 
+	/* The data is decrypted in place */
+	crypto_mod_clear_stream_hash();
+
 	return crypto_lib_desc.auth_decrypt(dec_algo, data_ptr, len, key,
 					    key_len, key_flags, iv, iv_len, tag,
 					    tag_len);
@@ -51,6 +51,10 @@ void mbedtls_init(void)
 #ifdef MBEDTLS_PLATFORM_SNPRINTF_ALT
 		mbedtls_platform_set_snprintf(snprintf);
 #endif
+
+#ifdef MBEDTLS_SHA256_PROCESS_ALT
+		mbedtls_sha2_ce_init();
+#endif
 		ready = 1;
 	}
 }
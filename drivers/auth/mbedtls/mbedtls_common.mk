@@ -21,6 +21,19 @@ $(eval $(call add_define,MBEDTLS_CONFIG_FILE))
 
 MBEDTLS_SOURCES	+=		drivers/auth/mbedtls/mbedtls_common.c
 
+# Hash block functions using the Armv8 Cryptographic Extension. There is no
+# portable fallback, so the instructions must be present (no FEAT_STATE_2).
+ifneq ($(filter 2,${ENABLE_FEAT_SHA256} ${ENABLE_FEAT_SHA512}),)
+  $(error "ENABLE_FEAT_SHA256/ENABLE_FEAT_SHA512 can only be 0 or 1 with mbed TLS")
+endif
+ifeq (${ENABLE_FEAT_SHA512}-${ENABLE_FEAT_SHA256},1-0)
+  $(error "ENABLE_FEAT_SHA512 requires ENABLE_FEAT_SHA256")
+endif
+ifeq (${ENABLE_FEAT_SHA256},1)
+MBEDTLS_SOURCES	+=		drivers/auth/mbedtls/mbedtls_sha2_ce.c	\
+				drivers/auth/mbedtls/sha2_ce.S
+endif
+
 
 LIBMBEDTLS_SRCS		:= $(addprefix ${MBEDTLS_DIR}/library/,	\
 					aes.c 					\
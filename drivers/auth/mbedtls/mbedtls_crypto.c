@@ -24,7 +24,6 @@
 
 #define LIB_NAME		"mbed TLS"
 
-#if MEASURED_BOOT
 /*
  * CRYPTO_MD_MAX_SIZE value is as per current stronger algorithm available
  * so make sure that mbed TLS MD maximum size must be lesser than this.
@@ -32,7 +31,25 @@
 CASSERT(CRYPTO_MD_MAX_SIZE >= MBEDTLS_MD_MAX_SIZE,
 	assert_mbedtls_md_size_overflow);
 
-#endif /* MEASURED_BOOT */
+/*
+ * Algorithm used to hash images while they are loaded: the one they are
+ * authenticated with or, without Trusted Board Boot, the measurement one.
+ */
+#if TRUSTED_BOARD_BOOT
+#define STREAM_HASH_ALG_ID	TF_MBEDTLS_HASH_ALG_ID
+#else
+#define STREAM_HASH_ALG_ID	TF_MBEDTLS_TPM_HASH_ALG_ID
+#endif
+
+#if (STREAM_HASH_ALG_ID == TF_MBEDTLS_SHA512)
+#define STREAM_HASH_ALG		CRYPTO_MD_SHA512
+#elif (STREAM_HASH_ALG_ID == TF_MBEDTLS_SHA384)
+#define STREAM_HASH_ALG		CRYPTO_MD_SHA384
+#else
+#define STREAM_HASH_ALG		CRYPTO_MD_SHA256
+#endif
+
+static mbedtls_md_context_t stream_md_ctx;
 
 /*
  * AlgorithmIdentifier  ::=  SEQUENCE  {
@@ -60,6 +77,83 @@ static void init(void)
 	mbedtls_init();
 }
 
+/*
+ * Map a generic crypto message digest algorithm to the corresponding macro used
+ * by Mbed TLS.
+ */
+static inline mbedtls_md_type_t md_type(enum crypto_md_algo algo)
+{
+	switch (algo) {
+	case CRYPTO_MD_SHA512:
+		return MBEDTLS_MD_SHA512;
+	case CRYPTO_MD_SHA384:
+		return MBEDTLS_MD_SHA384;
+	case CRYPTO_MD_SHA256:
+		return MBEDTLS_MD_SHA256;
+	default:
+		/* Invalid hash algorithm. */
+		return MBEDTLS_MD_NONE;
+	}
+}
+
+/*
+ * Incremental hash of a single stream, see crypto_mod_hash_init()
+ */
+static int hash_init(void)
+{
+	const mbedtls_md_info_t *md_info;
+	int rc;
+
+	md_info = mbedtls_md_info_from_type(md_type(STREAM_HASH_ALG));
+	if (md_info == NULL) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	mbedtls_md_free(&stream_md_ctx);
+	mbedtls_md_init(&stream_md_ctx);
+
+	rc = mbedtls_md_setup(&stream_md_ctx, md_info, 0);
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	rc = mbedtls_md_starts(&stream_md_ctx);
+	if (rc != 0) {
+		mbedtls_md_free(&stream_md_ctx);
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_update(void *data_ptr, unsigned int data_len)
+{
+	int rc;
+
+	rc = mbedtls_md_update(&stream_md_ctx, data_ptr, data_len);
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_final(enum crypto_md_algo *md_alg,
+		      unsigned char output[CRYPTO_MD_MAX_SIZE])
+{
+	int rc;
+
+	rc = mbedtls_md_finish(&stream_md_ctx, output);
+	mbedtls_md_free(&stream_md_ctx);
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	*md_alg = STREAM_HASH_ALG;
+
+	return CRYPTO_SUCCESS;
+}
+
 #if TRUSTED_BOARD_BOOT
 /*
  * Verify a signature.
@@ -163,7 +257,8 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	mbedtls_md_type_t md_alg;
 	const mbedtls_md_info_t *md_info;
 	unsigned char *p, *end, *hash;
-	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
+	unsigned char data_hash[CRYPTO_MD_MAX_SIZE];
+	enum crypto_md_algo stream_alg;
 	size_t len;
 	int rc;
 
@@ -204,11 +299,18 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	}
 	hash = p;
 
-	/* Calculate the hash of the data */
-	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, data_hash);
-	if (rc != 0) {
-		return CRYPTO_ERR_HASH;
+	/*
+	 * Calculate the hash of the data, unless it was already hashed with
+	 * the same algorithm while it was loaded
+	 */
+	rc = crypto_mod_get_stream_hash(data_ptr, data_len, &stream_alg,
+					data_hash);
+	if ((rc != CRYPTO_SUCCESS) || (md_type(stream_alg) != md_alg)) {
+		p = (unsigned char *)data_ptr;
+		rc = mbedtls_md(md_info, p, data_len, data_hash);
+		if (rc != 0) {
+			return CRYPTO_ERR_HASH;
+		}
 	}
 
 	/* Compare values */
@@ -222,25 +324,6 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 #endif /* TRUSTED_BOARD_BOOT */
 
 #if MEASURED_BOOT
-/*
- * Map a generic crypto message digest algorithm to the corresponding macro used
- * by Mbed TLS.
- */
-static inline mbedtls_md_type_t md_type(enum crypto_md_algo algo)
-{
-	switch (algo) {
-	case CRYPTO_MD_SHA512:
-		return MBEDTLS_MD_SHA512;
-	case CRYPTO_MD_SHA384:
-		return MBEDTLS_MD_SHA384;
-	case CRYPTO_MD_SHA256:
-		return MBEDTLS_MD_SHA256;
-	default:
-		/* Invalid hash algorithm. */
-		return MBEDTLS_MD_NONE;
-	}
-}
-
 /*
  * Calculate a hash
  *
@@ -368,21 +451,25 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 /*
  * Register crypto library descriptor
  */
+#define STREAM_HASH_OPS	.hash_init = hash_init, .hash_update = hash_update, \
+			.hash_final = hash_final
+
 #if MEASURED_BOOT && TRUSTED_BOARD_BOOT
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    auth_decrypt);
+		    auth_decrypt, STREAM_HASH_OPS);
 #else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    NULL);
+		    NULL, STREAM_HASH_OPS);
 #endif
 #elif TRUSTED_BOARD_BOOT
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash,
-		    auth_decrypt);
+		    auth_decrypt, STREAM_HASH_OPS);
 #else
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL);
+REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
+		    STREAM_HASH_OPS);
 #endif
 #elif MEASURED_BOOT
-REGISTER_CRYPTO_LIB(LIB_NAME, init, calc_hash);
+REGISTER_CRYPTO_LIB(LIB_NAME, init, calc_hash, STREAM_HASH_OPS);
 #endif /* MEASURED_BOOT && TRUSTED_BOARD_BOOT */
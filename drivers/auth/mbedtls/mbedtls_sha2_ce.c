@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* mbed TLS headers */
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
+
+#include <arch.h>
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/feat_detect.h>
+#include <drivers/auth/mbedtls/mbedtls_common.h>
+#include MBEDTLS_CONFIG_FILE
+#include <plat/common/platform.h>
+
+/*
+ * Block functions of the SHA-256 and SHA-512 implementations using the Armv8
+ * Cryptographic Extension instructions, see sha2_ce.S.
+ */
+void sha256_ce_transform(uint32_t state[8], const uint8_t *data,
+			 size_t blocks);
+void sha512_ce_transform(uint64_t state[8], const uint8_t *data,
+			 size_t blocks);
+
+#ifdef MBEDTLS_SHA256_PROCESS_ALT
+int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx,
+				    const unsigned char data[64])
+{
+	sha256_ce_transform(ctx->state, data, 1U);
+
+	return 0;
+}
+#endif /* MBEDTLS_SHA256_PROCESS_ALT */
+
+#ifdef MBEDTLS_SHA512_PROCESS_ALT
+int mbedtls_internal_sha512_process(mbedtls_sha512_context *ctx,
+				    const unsigned char data[128])
+{
+	sha512_ce_transform(ctx->state, data, 1U);
+
+	return 0;
+}
+#endif /* MBEDTLS_SHA512_PROCESS_ALT */
+
+/*
+ * FIPS 180-4 example messages of one and two blocks and their digests, as
+ * given by the portable implementation of mbed TLS.
+ */
+static const unsigned char sha2_ce_msg_abc[] = "abc";
+static const unsigned char sha2_ce_msg_256[] =
+	"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+static const unsigned char sha2_ce_abc_256[32] = {
+	0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+	0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+	0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+	0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+};
+
+static const unsigned char sha2_ce_2blk_256[32] = {
+	0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8,
+	0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+	0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+	0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1,
+};
+
+#ifdef MBEDTLS_SHA512_PROCESS_ALT
+static const unsigned char sha2_ce_msg_512[] =
+	"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+	"hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+static const unsigned char sha2_ce_abc_512[64] = {
+	0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba,
+	0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+	0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+	0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+	0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8,
+	0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+	0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e,
+	0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f,
+};
+
+static const unsigned char sha2_ce_2blk_512[64] = {
+	0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda,
+	0x8c, 0xf4, 0xf7, 0x28, 0x14, 0xfc, 0x14, 0x3f,
+	0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1,
+	0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18,
+	0x50, 0x1d, 0x28, 0x9e, 0x49, 0x00, 0xf7, 0xe4,
+	0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+	0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54,
+	0x5e, 0x96, 0xe5, 0x5b, 0x87, 0x4b, 0xe9, 0x09,
+};
+#endif /* MBEDTLS_SHA512_PROCESS_ALT */
+
+static void sha2_ce_check(int ret, const unsigned char *digest,
+			  const unsigned char *expected, size_t len,
+			  const char *name)
+{
+	if ((ret != 0) || (memcmp(digest, expected, len) != 0)) {
+		ERROR("%s instructions give a wrong digest\n", name);
+		panic();
+	}
+}
+
+/*
+ * Called from mbedtls_init() before the first hash. The block functions have
+ * no fallback and use the SIMD registers, so check that the instructions are
+ * present, that the registers do not trap in this image and that the digests
+ * match those of the portable implementation.
+ */
+void mbedtls_sha2_ce_init(void)
+{
+	unsigned char digest[64];
+	u_register_t cpacr;
+
+	feat_detect_panic(is_armv8_0_feat_sha256_present(), "SHA256");
+#ifdef MBEDTLS_SHA512_PROCESS_ALT
+	feat_detect_panic(is_armv8_2_feat_sha512_present(), "SHA512");
+#endif
+
+	/*
+	 * At EL1 (BL2 in the BL1 to BL2 flow) the image owns CPACR_EL1. At EL3
+	 * FP/SIMD accesses are not trapped as long as CPTR_EL3.TFP is clear.
+	 */
+	if (IS_IN_EL1()) {
+		cpacr = read_cpacr_el1();
+		if ((cpacr & CPACR_EL1_FPEN(CPACR_EL1_FP_TRAP_NONE)) !=
+		    CPACR_EL1_FPEN(CPACR_EL1_FP_TRAP_NONE)) {
+			write_cpacr_el1(cpacr |
+				CPACR_EL1_FPEN(CPACR_EL1_FP_TRAP_NONE));
+			isb();
+		}
+	} else {
+		assert(IS_IN_EL3());
+		assert((read_cptr_el3() & TFP_BIT) == 0U);
+	}
+
+	sha2_ce_check(mbedtls_sha256_ret(sha2_ce_msg_abc,
+					 sizeof(sha2_ce_msg_abc) - 1U,
+					 digest, 0),
+		      digest, sha2_ce_abc_256, 32U, "SHA256");
+	sha2_ce_check(mbedtls_sha256_ret(sha2_ce_msg_256,
+					 sizeof(sha2_ce_msg_256) - 1U,
+					 digest, 0),
+		      digest, sha2_ce_2blk_256, 32U, "SHA256");
+#ifdef MBEDTLS_SHA512_PROCESS_ALT
+	sha2_ce_check(mbedtls_sha512_ret(sha2_ce_msg_abc,
+					 sizeof(sha2_ce_msg_abc) - 1U,
+					 digest, 0),
+		      digest, sha2_ce_abc_512, 64U, "SHA512");
+	sha2_ce_check(mbedtls_sha512_ret(sha2_ce_msg_512,
+					 sizeof(sha2_ce_msg_512) - 1U,
+					 digest, 0),
+		      digest, sha2_ce_2blk_512, 64U, "SHA512");
+#endif
+}
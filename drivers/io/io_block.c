@@ -15,6 +15,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_storage.h>
 #include <lib/utils.h>
+#include <lib/utils_def.h>
 
 typedef struct {
 	io_block_dev_spec_t	*dev_spec;
@@ -25,6 +26,17 @@ typedef struct {
 
 #define is_power_of_2(x)	(((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
 
+/*
+ * Platforms whose block driver can transfer to any buffer aligned to this
+ * many bytes (for example CACHE_WRITEBACK_GRANULE) define it in
+ * platform_def.h. Whole blocks are then read straight into the caller's
+ * buffer, at most the bounce buffer length at a time, and only partial blocks
+ * go through the bounce buffer. 0 (the default) always uses the bounce buffer.
+ */
+#ifndef IO_BLOCK_DIRECT_READ_ALIGN
+#define IO_BLOCK_DIRECT_READ_ALIGN	0
+#endif
+
 io_type_t device_type_block(void);
 
 static int block_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -240,6 +252,12 @@ static int block_seek(io_entity_t *entity, int mode, signed long long offset)
  *
  * Additionally, the IO driver has an underlying buffer that is at least
  * one block-size and may be big enough to allow.
+ *
+ * When IO_BLOCK_DIRECT_READ_ALIGN is set, an iteration starts on a block
+ * boundary, covers at least one whole block and the destination is aligned to
+ * IO_BLOCK_DIRECT_READ_ALIGN, the whole blocks (up to the size of the
+ * underlying buffer) are read straight into the user buffer instead, skipping
+ * the copy out of the underlying buffer.
  */
 static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		      size_t *length_read)
@@ -296,6 +314,22 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		 */
 		lba = (cur->file_pos + cur->base) / block_size;
 
+#if IO_BLOCK_DIRECT_READ_ALIGN
+		if ((skip == 0U) && (left >= block_size) &&
+		    (((buffer + count) & (IO_BLOCK_DIRECT_READ_ALIGN - 1U)) == 0U)) {
+			request = MIN(left, buf->length) & ~(block_size - 1U);
+			request = ops->read(lba, buffer + count, request);
+			if (request == 0U) {
+				return -EIO;
+			}
+
+			nbytes = request;
+			cur->file_pos += nbytes;
+			count += nbytes;
+			continue;
+		}
+#endif
+
 		if ((skip + left) > buf->length) {
 			/*
 			 * The underlying read buffer is too small to
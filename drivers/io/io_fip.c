@@ -6,6 +6,8 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -16,6 +18,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_fip.h>
 #include <drivers/io/io_storage.h>
+#include <lib/cassert.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
 #include <tools_share/firmware_image_package.h>
@@ -25,6 +28,15 @@
 #define MAX_FIP_DEVICES		1
 #endif
 
+/*
+ * Number of ToC entries read along with the header by fip_dev_init(). Files
+ * past the end of the cache are still found by walking the ToC on the media.
+ * 0 disables the cache.
+ */
+#ifndef FIP_TOC_INDEX_ENTRIES
+#define FIP_TOC_INDEX_ENTRIES	16
+#endif
+
 /* Useful for printing UUIDs when debugging.*/
 #define PRINT_UUID2(x)								\
 	"%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx",	\
@@ -60,6 +72,32 @@ static fip_file_state_t current_fip_file = {0};
 static uintptr_t backend_dev_handle;
 static uintptr_t backend_image_spec;
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+/*
+ * Header and ToC entries read in one go by every fip_dev_init(), so that
+ * opening a file does not go back to the media. Like the backend it was read
+ * from, the index is shared by all FIP devices. It is only used with the
+ * backend handle and spec it was read through, and fip_dev_close() drops it.
+ */
+typedef struct {
+	fip_toc_header_t header;
+	fip_toc_entry_t entry[FIP_TOC_INDEX_ENTRIES];
+	uintptr_t dev_handle;
+	uintptr_t image_spec;
+	unsigned int count;
+	/* Set if the ToC end marker is in the index, i.e. no entry is missing */
+	bool complete;
+} fip_toc_index_t;
+
+/* The header and the entries are read with a single backend read */
+CASSERT(offsetof(fip_toc_index_t, entry) == sizeof(fip_toc_header_t),
+	assert_fip_toc_index_contiguous);
+
+static fip_toc_index_t toc_index;
+#endif /* FIP_TOC_INDEX_ENTRIES > 0 */
+
+static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
+
 static fip_dev_state_t state_pool[MAX_FIP_DEVICES];
 static io_dev_info_t dev_info_pool[MAX_FIP_DEVICES];
 
@@ -95,6 +133,66 @@ static inline int is_valid_header(fip_toc_header_t *header)
 }
 
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+/* Check whether the ToC index was read from the current backend */
+static bool is_toc_index_valid(void)
+{
+	return (toc_index.dev_handle != (uintptr_t)NULL) &&
+	       (toc_index.dev_handle == backend_dev_handle) &&
+	       (toc_index.image_spec == backend_image_spec);
+}
+
+/*
+ * Read the header and the ToC entries that follow it with a single backend
+ * read, and return the header. The index is only marked valid once the caller
+ * has checked the header; until then, and on failure, files are looked up on
+ * the media.
+ */
+static int load_toc_index(uintptr_t backend_handle, fip_toc_header_t *header)
+{
+	size_t fip_size;
+	size_t length;
+	size_t bytes_read;
+	unsigned int count;
+	unsigned int i;
+	int result;
+
+	zeromem(&toc_index, sizeof(toc_index));
+
+	length = sizeof(toc_index.header) + sizeof(toc_index.entry);
+	if ((io_size(backend_handle, &fip_size) == 0) &&
+	    (fip_size < length)) {
+		length = fip_size;
+	}
+
+	result = io_read(backend_handle, (uintptr_t)&toc_index.header, length,
+			 &bytes_read);
+	if ((result != 0) || (bytes_read < sizeof(toc_index.header))) {
+		zeromem(&toc_index, sizeof(toc_index));
+		*header = toc_index.header;
+		return result;
+	}
+
+	count = (unsigned int)((bytes_read - sizeof(toc_index.header)) /
+			       sizeof(fip_toc_entry_t));
+	for (i = 0U; i < count; i++) {
+		if (compare_uuids(&toc_index.entry[i].uuid, &uuid_null) == 0) {
+			toc_index.complete = true;
+			break;
+		}
+	}
+
+	toc_index.count = i;
+	*header = toc_index.header;
+
+	VERBOSE("FIP ToC index: %u entries%s\n", toc_index.count,
+		toc_index.complete ? "" : " (partial)");
+
+	return 0;
+}
+#endif /* FIP_TOC_INDEX_ENTRIES > 0 */
+
+
 /* Identify the device type as a virtual driver */
 static io_type_t device_type_fip(void)
 {
@@ -219,13 +317,20 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 	unsigned int image_id = (unsigned int)init_params;
 	uintptr_t backend_handle;
 	fip_toc_header_t header;
+#if FIP_TOC_INDEX_ENTRIES == 0
 	size_t bytes_read;
+#endif
 	fip_dev_state_t *state;
 
 	assert(dev_info != NULL);
 
 	state = (fip_dev_state_t *)dev_info->info;
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+	/* Until it is read again from the backend found below */
+	toc_index.dev_handle = (uintptr_t)NULL;
+#endif
+
 	/* Obtain a reference to the image by querying the platform layer */
 	result = plat_get_image_source(image_id, &backend_dev_handle,
 				       &backend_image_spec);
@@ -245,8 +350,12 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 		goto fip_dev_init_exit;
 	}
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+	result = load_toc_index(backend_handle, &header);
+#else
 	result = io_read(backend_handle, (uintptr_t)&header, sizeof(header),
 			&bytes_read);
+#endif
 	if (result == 0) {
 		if (!is_valid_header(&header)) {
 			WARN("Firmware Image Package header check failed.\n");
@@ -258,6 +367,10 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 			 * bits [32-47] in fip header.
 			 */
 			state->plat_toc_flag = (header.flags >> 32) & 0xffff;
+#if FIP_TOC_INDEX_ENTRIES > 0
+			toc_index.image_spec = backend_image_spec;
+			toc_index.dev_handle = backend_dev_handle;
+#endif
 		}
 	}
 
@@ -276,6 +389,11 @@ static int fip_dev_close(io_dev_info_t *dev_info)
 	backend_dev_handle = (uintptr_t)NULL;
 	backend_image_spec = (uintptr_t)NULL;
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+	/* The backend may point somewhere else when it is opened again */
+	zeromem(&toc_index, sizeof(toc_index));
+#endif
+
 	return free_dev_info(dev_info);
 }
 
@@ -287,9 +405,11 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 	int result;
 	uintptr_t backend_handle;
 	const io_uuid_spec_t *uuid_spec = (io_uuid_spec_t *)spec;
-	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
 	size_t bytes_read;
 	int found_file = 0;
+#if FIP_TOC_INDEX_ENTRIES > 0
+	unsigned int i;
+#endif
 
 	assert(uuid_spec != NULL);
 	assert(entity != NULL);
@@ -305,6 +425,24 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 		return -ENFILE;
 	}
 
+#if FIP_TOC_INDEX_ENTRIES > 0
+	if (is_toc_index_valid()) {
+		for (i = 0U; i < toc_index.count; i++) {
+			if (compare_uuids(&toc_index.entry[i].uuid,
+					  &uuid_spec->uuid) == 0) {
+				current_fip_file.entry = toc_index.entry[i];
+				current_fip_file.file_pos = 0;
+				entity->info = (uintptr_t)&current_fip_file;
+				return 0;
+			}
+		}
+
+		if (toc_index.complete) {
+			return -ENOENT;
+		}
+	}
+#endif
+
 	/* Attempt to access the FIP image */
 	result = io_open(backend_dev_handle, backend_image_spec,
 			 &backend_handle);
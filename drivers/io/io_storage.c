@@ -202,6 +202,15 @@ int io_dev_close(uintptr_t dev_handle)
 }
 
 
+/* Return the type of a device */
+io_type_t io_dev_type(uintptr_t dev_handle)
+{
+	assert(is_valid_dev(dev_handle));
+
+	return ((io_dev_info_t *)dev_handle)->funcs->type();
+}
+
+
 /* Synchronous operations */
 
 
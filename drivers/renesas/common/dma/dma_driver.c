@@ -10,6 +10,7 @@
 #include <arch_helpers.h>
 #include <common/debug.h>
 #include <lib/mmio.h>
+#include <lib/utils_def.h>
 
 #include "cpg_registers.h"
 #include "rcar_def.h"
@@ -62,6 +63,8 @@
 #define DMATCR_CNT_SHIFT	(6U)
 #define DMATCR_MAX		(0x00FFFFFFU)
 #define DMACHCR_TRN_MODE	(0x00105409U)
+/* As DMACHCR_TRN_MODE, with the source address fixed */
+#define DMACHCR_FILL_MODE	(0x00104409U)
 #define DMACHCR_DE_BIT		(0x00000001U)
 #define DMACHCR_TE_BIT		(0x00000002U)
 #define DMACHCR_CHE_BIT		(0x80000000U)
@@ -74,6 +77,10 @@
 #define DMA_LENGTH_LIMIT	((DMATCR_MAX * (1U << DMATCR_CNT_SHIFT)) \
 				& ~DMA_FRACTION_MASK)
 
+/* One transfer unit of zeroes, read over and over by rcar_dma_zero() */
+static uint8_t dma_zero_unit[1U << DMATCR_CNT_SHIFT]
+	__aligned(DMA_FRACTION_MASK + 1U);
+
 static void dma_enable(void)
 {
 	mstpcr_write(CPG_SMSTPCR2, CPG_MSTPSR2, SYS_DMAC_BIT);
@@ -85,7 +92,8 @@ static void dma_setup(void)
 	mmio_write_32(DMA_DMACHCLR, DMACHCLR_CH_ALL);
 }
 
-static void dma_start(uintptr_t dst, uint32_t src, uint32_t len)
+static void dma_start(uintptr_t dst, uint32_t src, uint32_t len,
+		      uint32_t mode)
 {
 	mmio_write_16(DMA_DMAOR, DMAOR_INITIAL);
 	mmio_write_32(DMA_DMAFIXDAR, (dst >> DMAFIXDAR_32BIT_SHIFT) &
@@ -94,7 +102,7 @@ static void dma_start(uintptr_t dst, uint32_t src, uint32_t len)
 	mmio_write_32(DMA_DMASAR, src);
 	mmio_write_32(DMA_DMATCR, len >> DMATCR_CNT_SHIFT);
 	mmio_write_32(DMA_DMASEC, DMA_USE_CHANNEL);
-	mmio_write_32(DMA_DMACHCR, DMACHCR_TRN_MODE);
+	mmio_write_32(DMA_DMACHCR, mode);
 }
 
 static void dma_end(void)
@@ -142,10 +150,40 @@ void rcar_dma_exec(uintptr_t dst, uint32_t src, uint32_t len)
 		panic();
 	}
 
-	dma_start(dst, src, dma_len);
+	dma_start(dst, src, dma_len, DMACHCR_TRN_MODE);
 	dma_end();
 }
 
+/*
+ * Fill memory with zeroes. The source address stays on dma_zero_unit, so the
+ * channel only reads SRAM while it streams writes to the destination. The
+ * area is split so that no transfer crosses a 4GB boundary.
+ */
+void rcar_dma_zero(uintptr_t dst, uint64_t len)
+{
+	uint64_t chunk;
+
+	if ((len & DMA_FRACTION_MASK) || (dst & DMA_FRACTION_MASK) ||
+	    (dst + len > DMA_DST_LIMIT)) {
+		ERROR("BL2: DMA - fill area invalid (0x%lx), len=(0x%lx)\n",
+		      dst, len);
+		panic();
+	}
+
+	while (len != 0U) {
+		chunk = MIN(len, (uint64_t)(DMADAR_BOUNDARY_ADDR -
+					     (dst & UINT32_MAX)));
+		chunk = MIN(chunk, (uint64_t)DMA_LENGTH_LIMIT);
+
+		dma_start(dst, (uint32_t)(uintptr_t)dma_zero_unit,
+			  (uint32_t)chunk, DMACHCR_FILL_MODE);
+		dma_end();
+
+		dst += chunk;
+		len -= chunk;
+	}
+}
+
 void rcar_dma_init(void)
 {
 	dma_enable();
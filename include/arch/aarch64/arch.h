@@ -243,6 +243,11 @@
 #define ID_AA64ISAR0_RNDR_SHIFT	U(60)
 #define ID_AA64ISAR0_RNDR_MASK	ULL(0xf)
 
+#define ID_AA64ISAR0_SHA2_SHIFT		U(12)
+#define ID_AA64ISAR0_SHA2_MASK		ULL(0xf)
+#define ID_AA64ISAR0_SHA2_SHA256	ULL(0x1)
+#define ID_AA64ISAR0_SHA2_SHA512	ULL(0x2)
+
 /* ID_AA64ISAR1_EL1 definitions */
 #define ID_AA64ISAR1_EL1		S3_0_C0_C6_1
 
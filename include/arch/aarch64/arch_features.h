@@ -100,6 +100,18 @@ static inline bool is_armv8_5_rng_present(void)
 		ID_AA64ISAR0_RNDR_MASK);
 }
 
+static inline bool is_armv8_0_feat_sha256_present(void)
+{
+	return ((read_id_aa64isar0_el1() >> ID_AA64ISAR0_SHA2_SHIFT) &
+		ID_AA64ISAR0_SHA2_MASK) >= ID_AA64ISAR0_SHA2_SHA256;
+}
+
+static inline bool is_armv8_2_feat_sha512_present(void)
+{
+	return ((read_id_aa64isar0_el1() >> ID_AA64ISAR0_SHA2_SHIFT) &
+		ID_AA64ISAR0_SHA2_MASK) >= ID_AA64ISAR0_SHA2_SHA512;
+}
+
 static inline bool is_armv8_6_feat_amuv1p1_present(void)
 {
 	return (((read_id_aa64pfr0_el1() >> ID_AA64PFR0_AMU_SHIFT) &
@@ -167,6 +167,10 @@ typedef struct meminfo {
  * Function & variable prototypes
  ******************************************************************************/
 int load_auth_image(unsigned int image_id, image_info_t *image_data);
+#if BL2_PIPELINED_LOAD
+int load_auth_image_start(unsigned int image_id, image_info_t *image_data);
+int load_auth_image_finish(unsigned int image_id, image_info_t *image_data);
+#endif
 
 #if TRUSTED_BOARD_BOOT && defined(DYN_DISABLE_AUTH)
 /*
@@ -16,9 +16,27 @@ typedef int (decompressor_t)(uintptr_t *in_buf, size_t in_len,
 			     uintptr_t *out_buf, size_t out_len,
 			     uintptr_t work_buf, size_t work_len);
 
+/*
+ * Streaming decompressors pull their input through a decompress_read_t, which
+ * reads up to 'len' bytes to 'buf' and returns the count in 'len_read' (0 at
+ * the end of the input). 'in_buf' is the input window they read to.
+ */
+typedef int (decompress_read_t)(void *handle, uintptr_t buf, size_t len,
+				size_t *len_read);
+
+typedef int (stream_decompressor_t)(decompress_read_t *read, void *handle,
+				    uintptr_t *out_buf, size_t out_len,
+				    uintptr_t in_buf, size_t in_len,
+				    uintptr_t work_buf, size_t work_len);
+
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *decompressor);
 void image_decompress_prepare(struct image_info *info);
 int image_decompress(struct image_info *info);
 
+void image_decompress_stream_init(uintptr_t in_base, size_t in_size,
+				  uintptr_t work_base, size_t work_size,
+				  stream_decompressor_t *decompressor);
+int image_decompress_stream(unsigned int image_id, struct image_info *info);
+
 #endif /* IMAGE_DECOMPRESS_H */
@@ -73,6 +73,16 @@ typedef struct crypto_lib_desc_s {
 			    unsigned int key_flags, const void *iv,
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len);
+
+	/*
+	 * Optional incremental hash of a single stream at a time, using the
+	 * algorithm images are authenticated (or else measured) with. Return
+	 * one of the 'enum crypto_ret_value' options.
+	 */
+	int (*hash_init)(void);
+	int (*hash_update)(void *data_ptr, unsigned int data_len);
+	int (*hash_final)(enum crypto_md_algo *md_alg,
+			  unsigned char output[CRYPTO_MD_MAX_SIZE]);
 } crypto_lib_desc_t;
 
 /* Public functions */
@@ -102,34 +112,50 @@ int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 			 unsigned char output[CRYPTO_MD_MAX_SIZE]);
 #endif /* MEASURED_BOOT */
 
+#if CRYPTO_SUPPORT
+int crypto_mod_hash_init(void);
+int crypto_mod_hash_update(void *data_ptr, unsigned int data_len);
+int crypto_mod_hash_final(void);
+int crypto_mod_get_stream_hash(void *data_ptr, unsigned int data_len,
+			       enum crypto_md_algo *alg,
+			       unsigned char output[CRYPTO_MD_MAX_SIZE]);
+void crypto_mod_clear_stream_hash(void);
+#endif /* CRYPTO_SUPPORT */
+
+/*
+ * Macro to register a cryptographic library. Optional members, such as the
+ * incremental hash functions, may follow as designated initializers.
+ */
 #if MEASURED_BOOT && TRUSTED_BOARD_BOOT
-/* Macro to register a cryptographic library */
 #define REGISTER_CRYPTO_LIB(_name, _init, _verify_signature, _verify_hash, \
-			    _calc_hash, _auth_decrypt) \
+			    _calc_hash, _auth_decrypt, ...) \
 	const crypto_lib_desc_t crypto_lib_desc = { \
 		.name = _name, \
 		.init = _init, \
 		.verify_signature = _verify_signature, \
 		.verify_hash = _verify_hash, \
 		.calc_hash = _calc_hash, \
-		.auth_decrypt = _auth_decrypt \
+		.auth_decrypt = _auth_decrypt, \
+		__VA_ARGS__ \
 	}
 #elif TRUSTED_BOARD_BOOT
 #define REGISTER_CRYPTO_LIB(_name, _init, _verify_signature, _verify_hash, \
-			    _auth_decrypt) \
+			    _auth_decrypt, ...) \
 	const crypto_lib_desc_t crypto_lib_desc = { \
 		.name = _name, \
 		.init = _init, \
 		.verify_signature = _verify_signature, \
 		.verify_hash = _verify_hash, \
-		.auth_decrypt = _auth_decrypt \
+		.auth_decrypt = _auth_decrypt, \
+		__VA_ARGS__ \
 	}
 #elif MEASURED_BOOT
-#define REGISTER_CRYPTO_LIB(_name, _init, _calc_hash) \
+#define REGISTER_CRYPTO_LIB(_name, _init, _calc_hash, ...) \
 	const crypto_lib_desc_t crypto_lib_desc = { \
 		.name = _name, \
 		.init = _init, \
 		.calc_hash = _calc_hash, \
+		__VA_ARGS__ \
 	}
 #endif	/* MEASURED_BOOT && TRUSTED_BOARD_BOOT */
 
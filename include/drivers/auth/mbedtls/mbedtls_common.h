@@ -8,5 +8,6 @@
 #define MBEDTLS_COMMON_H
 
 void mbedtls_init(void);
+void mbedtls_sha2_ce_init(void);
 
 #endif /* MBEDTLS_COMMON_H */
@@ -86,6 +86,17 @@
 #endif
 #endif
 
+/*
+ * Replace the portable block functions of the hash algorithms with ones using
+ * the Armv8 Cryptographic Extension instructions.
+ */
+#if ENABLE_FEAT_SHA256
+#define MBEDTLS_SHA256_PROCESS_ALT
+#endif
+#if ENABLE_FEAT_SHA512 && defined(MBEDTLS_SHA512_C)
+#define MBEDTLS_SHA512_PROCESS_ALT
+#endif
+
 #define MBEDTLS_VERSION_C
 
 #define MBEDTLS_X509_USE_C
@@ -84,6 +84,9 @@ int io_dev_init(uintptr_t dev_handle, const uintptr_t init_params);
 /* Close a connection to a device */
 int io_dev_close(uintptr_t dev_handle);
 
+/* Return the type of a device */
+io_type_t io_dev_type(uintptr_t dev_handle);
+
 
 /* Synchronous operations */
 int io_open(uintptr_t dev_handle, const uintptr_t spec, uintptr_t *handle);
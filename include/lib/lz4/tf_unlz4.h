@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TF_UNLZ4_H
+#define TF_UNLZ4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <common/image_decompress.h>
+
+/*
+ * Runs fn(arg), on the calling core or another one, for unlz4() to decode the
+ * blocks of a frame in parallel. The wait function returns once every
+ * submitted job has finished and its results are visible to the caller.
+ */
+typedef void (*unlz4_job_fn_t)(void *arg);
+typedef void (unlz4_submit_t)(unlz4_job_fn_t fn, void *arg);
+typedef void (unlz4_wait_t)(void);
+
+void unlz4_set_jobs(unlz4_submit_t *submit, unlz4_wait_t *wait,
+		    unsigned int jobs);
+int unlz4(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+	  size_t out_len, uintptr_t work_buf, size_t work_len);
+int unlz4_stream(decompress_read_t *read, void *handle, uintptr_t *out_buf,
+		 size_t out_len, uintptr_t in_buf, size_t in_len,
+		 uintptr_t work_buf, size_t work_len);
+
+#endif /* TF_UNLZ4_H */
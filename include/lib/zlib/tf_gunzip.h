@@ -10,7 +10,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <common/image_decompress.h>
+
 int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 	   size_t out_len, uintptr_t work_buf, size_t work_len);
+int gunzip_stream(decompress_read_t *read, void *handle, uintptr_t *out_buf,
+		  size_t out_len, uintptr_t in_buf, size_t in_len,
+		  uintptr_t work_buf, size_t work_len);
 
 #endif /* TF_GUNZIP_H */
@@ -231,6 +231,10 @@ int bl2_plat_handle_post_image_load(unsigned int image_id);
 /*******************************************************************************
  * Optional BL2 functions (may be overridden)
  ******************************************************************************/
+#if BL2_PIPELINED_LOAD
+void bl2_plat_start_async_load(unsigned int image_id);
+int bl2_plat_wait_async_load(unsigned int image_id);
+#endif
 #if MEASURED_BOOT
 void bl2_plat_mboot_init(void);
 void bl2_plat_mboot_finish(void);
@@ -0,0 +1,697 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <lib/utils_def.h>
+#include <tf_unlz4.h>
+
+/*
+ * Decoder for the LZ4 frame format, as written by the lz4 command line tool
+ * and by lz4's LZ4F_compressFrame(). Linked and independent blocks are both
+ * supported since each frame is decoded into one contiguous output buffer.
+ * The header checksum is verified; block and content checksums are skipped,
+ * the image itself being authenticated separately when TBB is enabled.
+ * Preset dictionaries are not supported.
+ *
+ * Given a way to run jobs with unlz4_set_jobs(), unlz4() decodes the blocks of
+ * frames with independent blocks (lz4 -BI) as parallel jobs. The lz4 tool
+ * fills every block but the last, so block n is decoded to n times the block
+ * size into the frame's output; a frame where that does not hold is decoded
+ * again in order.
+ */
+#define LZ4_FRAME_MAGIC			U(0x184D2204)
+#define LZ4_SKIP_MAGIC			U(0x184D2A50)
+#define LZ4_SKIP_MAGIC_MASK		U(0xFFFFFFF0)
+
+#define LZ4_FLG_VERSION_MASK	U(0xC0)
+#define LZ4_FLG_VERSION			U(0x40)
+#define LZ4_FLG_BLOCK_INDEP		BIT(5)
+#define LZ4_FLG_BLOCK_CSUM		BIT(4)
+#define LZ4_FLG_CONTENT_SIZE	BIT(3)
+#define LZ4_FLG_CONTENT_CSUM	BIT(2)
+#define LZ4_FLG_DICT_ID			BIT(0)
+
+#define LZ4_BD_BLOCK_MAX_SHIFT	4U
+#define LZ4_BD_BLOCK_MAX_MASK	U(0x7)
+#define LZ4_BD_BLOCK_MAX_MIN	4U
+
+#define LZ4_BLOCK_UNCOMPRESSED	BIT(31)
+
+#define LZ4_MAX_JOBS			8U
+
+#define LZ4_MIN_MATCH			4U
+#define LZ4_RUN_MASK			15U
+
+#define XXH_PRIME32_1			U(0x9E3779B1)
+#define XXH_PRIME32_2			U(0x85EBCA77)
+#define XXH_PRIME32_3			U(0xC2B2AE3D)
+#define XXH_PRIME32_4			U(0x27D4EB2F)
+#define XXH_PRIME32_5			U(0x165667B1)
+
+/* One job decodes blocks [first, last) of a frame */
+struct lz4_job {
+	const uint8_t *in;
+	uint8_t *out;
+	const uint8_t *out_end;
+	size_t block_max;
+	unsigned int first;
+	unsigned int last;
+	unsigned int count;
+	bool block_csum;
+	uint8_t *end;
+	int ret;
+};
+
+static unlz4_submit_t *lz4_submit;
+static unlz4_wait_t *lz4_wait;
+static unsigned int lz4_njobs = 1U;
+static struct lz4_job lz4_jobs[LZ4_MAX_JOBS];
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+	       ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t rotl32(uint32_t x, unsigned int r)
+{
+	return (x << r) | (x >> (32U - r));
+}
+
+/* xxHash32 with seed 0, for inputs shorter than 16 bytes only */
+static uint32_t xxh32_short(const uint8_t *p, size_t len)
+{
+	const uint8_t *end = p + len;
+	uint32_t h = XXH_PRIME32_5 + (uint32_t)len;
+
+	for (; (end - p) >= 4; p += 4)
+		h = rotl32(h + (get_le32(p) * XXH_PRIME32_3), 17) * XXH_PRIME32_4;
+
+	for (; p < end; p++)
+		h = rotl32(h + (*p * XXH_PRIME32_5), 11) * XXH_PRIME32_1;
+
+	h ^= h >> 15;
+	h *= XXH_PRIME32_2;
+	h ^= h >> 13;
+	h *= XXH_PRIME32_3;
+	h ^= h >> 16;
+
+	return h;
+}
+
+/* Adds the extra length bytes that follow a run of LZ4_RUN_MASK */
+static int lz4_run_length(const uint8_t **in, const uint8_t *in_end,
+			  size_t *len)
+{
+	uint8_t byte;
+
+	do {
+		if (*in == in_end)
+			return -EIO;
+		byte = *(*in)++;
+		*len += byte;
+	} while (byte == 0xFFU);
+
+	return 0;
+}
+
+/*
+ * Decodes one compressed block of 'in_len' bytes at 'in' to *out. Matches may
+ * reach back as far as 'out_start', the start of the frame's output.
+ */
+static int lz4_block(const uint8_t *in, size_t in_len, uint8_t **out,
+		     const uint8_t *out_start, const uint8_t *out_end)
+{
+	const uint8_t *in_end = in + in_len;
+	const uint8_t *match;
+	uint8_t *op = *out;
+	size_t len, offset;
+	uint8_t token;
+
+	while (in < in_end) {
+		token = *in++;
+
+		/* Literals */
+		len = token >> 4;
+		if ((len == LZ4_RUN_MASK) &&
+		    (lz4_run_length(&in, in_end, &len) != 0))
+			return -EIO;
+		if ((len > (size_t)(in_end - in)) ||
+		    (len > (size_t)(out_end - op)))
+			return -EIO;
+		memcpy(op, in, len);
+		op += len;
+		in += len;
+
+		/* The last sequence of a block has no match */
+		if (in == in_end)
+			break;
+
+		/* Match */
+		if ((in_end - in) < 2)
+			return -EIO;
+		offset = (size_t)in[0] | ((size_t)in[1] << 8);
+		in += 2;
+		if ((offset == 0U) || (offset > (size_t)(op - out_start)))
+			return -EIO;
+
+		len = token & LZ4_RUN_MASK;
+		if ((len == LZ4_RUN_MASK) &&
+		    (lz4_run_length(&in, in_end, &len) != 0))
+			return -EIO;
+		len += LZ4_MIN_MATCH;
+		if (len > (size_t)(out_end - op))
+			return -EIO;
+
+		/* A match that overlaps its own output repeats it byte by byte */
+		match = op - offset;
+		if (offset >= len) {
+			memcpy(op, match, len);
+			op += len;
+		} else {
+			while (len-- != 0U)
+				*op++ = *match++;
+		}
+	}
+
+	*out = op;
+
+	return 0;
+}
+
+/* Length of the frame descriptor, from FLG up to the header checksum */
+static size_t lz4_desc_len(uint8_t flg)
+{
+	/* FLG, BD and the optional content size */
+	return 2U + (((flg & LZ4_FLG_CONTENT_SIZE) != 0U) ? 8U : 0U);
+}
+
+/* Checks the frame descriptor at 'p', followed by its header checksum */
+static int lz4_check_desc(const uint8_t *p, size_t out_room)
+{
+	uint8_t flg = p[0];
+	size_t desc_len = lz4_desc_len(flg);
+
+	if ((flg & LZ4_FLG_VERSION_MASK) != LZ4_FLG_VERSION) {
+		ERROR("lz4: unsupported frame version\n");
+		return -EIO;
+	}
+	if ((flg & LZ4_FLG_DICT_ID) != 0U) {
+		ERROR("lz4: preset dictionaries are not supported\n");
+		return -ENOTSUP;
+	}
+	if (((xxh32_short(p, desc_len) >> 8) & 0xFFU) != p[desc_len]) {
+		ERROR("lz4: bad frame header checksum\n");
+		return -EIO;
+	}
+	if (((flg & LZ4_FLG_CONTENT_SIZE) != 0U) &&
+	    ((get_le32(&p[6]) != 0U) || (get_le32(&p[2]) > out_room))) {
+		ERROR("lz4: output buffer too small\n");
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static void lz4_block_job(void *arg)
+{
+	struct lz4_job *job = arg;
+	const uint8_t *p = job->in;
+	const uint8_t *end;
+	uint8_t *start, *op = NULL;
+	size_t block_len;
+	unsigned int n;
+	uint32_t block;
+
+	job->ret = 0;
+
+	for (n = 0U; n < job->last; n++) {
+		block = get_le32(p);
+		p += 4;
+		block_len = block & ~LZ4_BLOCK_UNCOMPRESSED;
+
+		if (n >= job->first) {
+			start = job->out + (n * job->block_max);
+			end = start + MIN(job->block_max,
+					  (size_t)(job->out_end - start));
+			op = start;
+
+			if ((block & LZ4_BLOCK_UNCOMPRESSED) != 0U) {
+				if (block_len > (size_t)(end - op)) {
+					job->ret = -EAGAIN;
+					return;
+				}
+				memcpy(op, p, block_len);
+				op += block_len;
+			} else {
+				job->ret = lz4_block(p, block_len, &op, start,
+						     end);
+				if (job->ret != 0)
+					return;
+			}
+
+			/* Only the last block may be short */
+			if (((n + 1U) < job->count) &&
+			    (op != (start + job->block_max))) {
+				job->ret = -EAGAIN;
+				return;
+			}
+		}
+
+		p += block_len;
+		if (job->block_csum)
+			p += 4;
+	}
+
+	job->end = op;
+}
+
+/*
+ * Decodes the independent blocks of a frame, starting at the block header at
+ * *in, as parallel jobs. Returns -EAGAIN without any change to *in and *out
+ * when the frame has to be decoded in order instead.
+ */
+static int lz4_frame_jobs(const uint8_t **in, const uint8_t *in_end,
+			  uint8_t **out, const uint8_t *out_end, uint8_t flg,
+			  uint8_t bd)
+{
+	const uint8_t *p = *in;
+	unsigned int bd_max = (bd >> LZ4_BD_BLOCK_MAX_SHIFT) &
+			      LZ4_BD_BLOCK_MAX_MASK;
+	bool block_csum = (flg & LZ4_FLG_BLOCK_CSUM) != 0U;
+	struct lz4_job *job;
+	size_t block_max, block_len;
+	unsigned int count, njobs, i;
+	uint32_t block;
+
+	if ((lz4_submit == NULL) || ((flg & LZ4_FLG_BLOCK_INDEP) == 0U) ||
+	    (bd_max < LZ4_BD_BLOCK_MAX_MIN))
+		return -EAGAIN;
+
+	/* 64 KiB, 256 KiB, 1 MiB or 4 MiB */
+	block_max = (size_t)1U << (8U + (2U * bd_max));
+
+	/* Count the blocks, so that the jobs need no bounds checks */
+	for (count = 0U; ; count++) {
+		if ((in_end - p) < 4)
+			return -EAGAIN;
+		block = get_le32(p);
+		p += 4;
+		if (block == 0U)
+			break;
+
+		block_len = (block & ~LZ4_BLOCK_UNCOMPRESSED) +
+			    (block_csum ? 4U : 0U);
+		if (block_len > (size_t)(in_end - p))
+			return -EAGAIN;
+		p += block_len;
+	}
+
+	if ((count < 2U) ||
+	    ((size_t)(out_end - *out) / block_max < (count - 1U)))
+		return -EAGAIN;
+
+	njobs = MIN(lz4_njobs, count);
+	for (i = 0U; i < njobs; i++) {
+		job = &lz4_jobs[i];
+		job->in = *in;
+		job->out = *out;
+		job->out_end = out_end;
+		job->block_max = block_max;
+		job->first = (count * i) / njobs;
+		job->last = (count * (i + 1U)) / njobs;
+		job->count = count;
+		job->block_csum = block_csum;
+		lz4_submit(lz4_block_job, job);
+	}
+	lz4_wait();
+
+	for (i = 0U; i < njobs; i++) {
+		if (lz4_jobs[i].ret == -EAGAIN)
+			return -EAGAIN;
+		if (lz4_jobs[i].ret != 0) {
+			ERROR("lz4: corrupt block\n");
+			return lz4_jobs[i].ret;
+		}
+	}
+
+	*in = p;
+	*out = lz4_jobs[njobs - 1U].end;
+
+	return 0;
+}
+
+static int lz4_frame(const uint8_t **in, const uint8_t *in_end,
+		     uint8_t **out, const uint8_t *out_end)
+{
+	const uint8_t *p = *in + 4;
+	const uint8_t *out_start = *out;
+	uint8_t *op = *out;
+	size_t desc_len, block_len;
+	uint32_t block;
+	uint8_t flg, bd;
+	int ret;
+
+	if (in_end == p) {
+		ERROR("lz4: truncated frame header\n");
+		return -EIO;
+	}
+
+	flg = p[0];
+	desc_len = lz4_desc_len(flg);
+	if ((size_t)(in_end - p) < (desc_len + 1U)) {
+		ERROR("lz4: truncated frame header\n");
+		return -EIO;
+	}
+	ret = lz4_check_desc(p, (size_t)(out_end - op));
+	if (ret != 0)
+		return ret;
+	bd = p[1];
+	p += desc_len + 1U;
+
+	ret = lz4_frame_jobs(&p, in_end, &op, out_end, flg, bd);
+	if (ret != -EAGAIN) {
+		if (ret != 0)
+			return ret;
+		goto frame_end;
+	}
+
+	for (;;) {
+		if ((in_end - p) < 4) {
+			ERROR("lz4: truncated block\n");
+			return -EIO;
+		}
+		block = get_le32(p);
+		p += 4;
+
+		/* End mark */
+		if (block == 0U)
+			break;
+
+		block_len = block & ~LZ4_BLOCK_UNCOMPRESSED;
+		if (block_len > (size_t)(in_end - p)) {
+			ERROR("lz4: truncated block\n");
+			return -EIO;
+		}
+
+		if ((block & LZ4_BLOCK_UNCOMPRESSED) != 0U) {
+			if (block_len > (size_t)(out_end - op)) {
+				ERROR("lz4: output buffer too small\n");
+				return -ENOMEM;
+			}
+			memcpy(op, p, block_len);
+			op += block_len;
+		} else {
+			ret = lz4_block(p, block_len, &op, out_start, out_end);
+			if (ret != 0) {
+				ERROR("lz4: corrupt block\n");
+				return ret;
+			}
+		}
+		p += block_len;
+
+		if ((flg & LZ4_FLG_BLOCK_CSUM) != 0U) {
+			if ((in_end - p) < 4) {
+				ERROR("lz4: truncated block\n");
+				return -EIO;
+			}
+			p += 4;
+		}
+	}
+
+frame_end:
+	if ((flg & LZ4_FLG_CONTENT_CSUM) != 0U) {
+		if ((in_end - p) < 4) {
+			ERROR("lz4: truncated frame\n");
+			return -EIO;
+		}
+		p += 4;
+	}
+
+	*in = p;
+	*out = op;
+
+	return 0;
+}
+
+void unlz4_set_jobs(unlz4_submit_t *submit, unlz4_wait_t *wait,
+		    unsigned int jobs)
+{
+	assert((submit == NULL) || (wait != NULL));
+
+	lz4_submit = (jobs > 1U) ? submit : NULL;
+	lz4_wait = wait;
+	lz4_njobs = MIN(jobs, LZ4_MAX_JOBS);
+}
+
+/*
+ * unlz4 - decompress LZ4 frame data
+ * @in_buf: source of compressed input. Upon exit, the end of input.
+ * @in_len: length of in_buf
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @work_buf: workspace (unused, LZ4 needs none)
+ * @work_len: length of workspace
+ */
+int unlz4(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+	  size_t out_len, uintptr_t work_buf, size_t work_len)
+{
+	const uint8_t *in = (const uint8_t *)*in_buf;
+	const uint8_t *in_end = in + in_len;
+	uint8_t *out = (uint8_t *)*out_buf;
+	const uint8_t *out_end = out + out_len;
+	unsigned int frames = 0U;
+	uint32_t magic, skip;
+	int ret = 0;
+
+	while ((ret == 0) && ((in_end - in) >= 4)) {
+		magic = get_le32(in);
+
+		if ((magic & LZ4_SKIP_MAGIC_MASK) == LZ4_SKIP_MAGIC) {
+			if ((in_end - in) < 8) {
+				ret = -EIO;
+				break;
+			}
+			skip = get_le32(&in[4]);
+			if (skip > (size_t)(in_end - in - 8)) {
+				ret = -EIO;
+				break;
+			}
+			in += 8U + skip;
+			continue;
+		}
+
+		if (magic != LZ4_FRAME_MAGIC) {
+			ERROR("lz4: bad frame magic 0x%x\n", magic);
+			ret = -EIO;
+			break;
+		}
+
+		ret = lz4_frame(&in, in_end, &out, out_end);
+		frames++;
+	}
+
+	if ((ret == 0) && (frames == 0U)) {
+		ERROR("lz4: no frame found\n");
+		ret = -EIO;
+	}
+
+	VERBOSE("lz4: %lu byte input\n",
+		(unsigned long)(in - (const uint8_t *)*in_buf));
+	VERBOSE("lz4: %lu byte output\n",
+		(unsigned long)(out - (uint8_t *)*out_buf));
+
+	*in_buf = (uintptr_t)in;
+	*out_buf = (uintptr_t)out;
+
+	return ret;
+}
+
+/* Reads exactly 'len' bytes of input to 'buf' */
+static int lz4_read(decompress_read_t *read, void *handle, uint8_t *buf,
+		    size_t len)
+{
+	size_t len_read;
+	int ret;
+
+	while (len != 0U) {
+		ret = read(handle, (uintptr_t)buf, len, &len_read);
+		if (ret != 0)
+			return ret;
+		if (len_read == 0U) {
+			ERROR("lz4: truncated input\n");
+			return -EIO;
+		}
+		buf += len_read;
+		len -= len_read;
+	}
+
+	return 0;
+}
+
+/*
+ * Streaming counterpart of lz4_frame(), called with the frame magic already
+ * read. Compressed blocks are read whole to the input window and decoded
+ * from there, stored blocks are read straight to the output.
+ */
+static int lz4_stream_frame(decompress_read_t *read, void *handle,
+			    uint8_t **out, const uint8_t *out_end,
+			    uint8_t *window, size_t window_len)
+{
+	const uint8_t *out_start = *out;
+	uint8_t *op = *out;
+	uint8_t desc[11];
+	size_t block_len;
+	uint32_t block;
+	uint8_t flg;
+	int ret;
+
+	ret = lz4_read(read, handle, desc, 1U);
+	if (ret != 0)
+		return ret;
+	flg = desc[0];
+	ret = lz4_read(read, handle, &desc[1], lz4_desc_len(flg));
+	if (ret != 0)
+		return ret;
+	ret = lz4_check_desc(desc, (size_t)(out_end - op));
+	if (ret != 0)
+		return ret;
+
+	for (;;) {
+		ret = lz4_read(read, handle, window, 4U);
+		if (ret != 0)
+			return ret;
+		block = get_le32(window);
+
+		/* End mark */
+		if (block == 0U)
+			break;
+
+		block_len = block & ~LZ4_BLOCK_UNCOMPRESSED;
+		if ((block & LZ4_BLOCK_UNCOMPRESSED) != 0U) {
+			if (block_len > (size_t)(out_end - op)) {
+				ERROR("lz4: output buffer too small\n");
+				return -ENOMEM;
+			}
+			ret = lz4_read(read, handle, op, block_len);
+			if (ret != 0)
+				return ret;
+			op += block_len;
+		} else {
+			if (block_len > window_len) {
+				ERROR("lz4: block larger than the input window\n");
+				return -ENOMEM;
+			}
+			ret = lz4_read(read, handle, window, block_len);
+			if (ret != 0)
+				return ret;
+			ret = lz4_block(window, block_len, &op, out_start, out_end);
+			if (ret != 0) {
+				ERROR("lz4: corrupt block\n");
+				return ret;
+			}
+		}
+
+		if ((flg & LZ4_FLG_BLOCK_CSUM) != 0U) {
+			ret = lz4_read(read, handle, window, 4U);
+			if (ret != 0)
+				return ret;
+		}
+	}
+
+	if ((flg & LZ4_FLG_CONTENT_CSUM) != 0U) {
+		ret = lz4_read(read, handle, window, 4U);
+		if (ret != 0)
+			return ret;
+	}
+
+	*out = op;
+
+	return 0;
+}
+
+/*
+ * unlz4_stream - decompress LZ4 frame data read in chunks
+ * @read: reads the next chunk of compressed input
+ * @handle: argument of read
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @in_buf: input window, which must hold the largest compressed block
+ * @in_len: length of in_buf
+ * @work_buf: workspace (unused, LZ4 needs none)
+ * @work_len: length of workspace
+ */
+int unlz4_stream(decompress_read_t *read, void *handle, uintptr_t *out_buf,
+		 size_t out_len, uintptr_t in_buf, size_t in_len,
+		 uintptr_t work_buf, size_t work_len)
+{
+	uint8_t *window = (uint8_t *)in_buf;
+	uint8_t *out = (uint8_t *)*out_buf;
+	const uint8_t *out_end = out + out_len;
+	unsigned int frames = 0U;
+	size_t len_read, skip;
+	uint32_t magic;
+	int ret;
+
+	assert(in_len >= 8U);
+
+	for (;;) {
+		/* The input may only end between frames */
+		ret = read(handle, in_buf, 4U, &len_read);
+		if ((ret != 0) || (len_read == 0U))
+			break;
+		ret = lz4_read(read, handle, &window[len_read], 4U - len_read);
+		if (ret != 0)
+			break;
+		magic = get_le32(window);
+
+		if ((magic & LZ4_SKIP_MAGIC_MASK) == LZ4_SKIP_MAGIC) {
+			ret = lz4_read(read, handle, window, 4U);
+			if (ret != 0)
+				break;
+			for (skip = get_le32(window); skip != 0U;
+			     skip -= len_read) {
+				len_read = MIN(skip, in_len);
+				ret = lz4_read(read, handle, window, len_read);
+				if (ret != 0)
+					break;
+			}
+			if (ret != 0)
+				break;
+			continue;
+		}
+
+		if (magic != LZ4_FRAME_MAGIC) {
+			ERROR("lz4: bad frame magic 0x%x\n", magic);
+			ret = -EIO;
+			break;
+		}
+
+		ret = lz4_stream_frame(read, handle, &out, out_end, window,
+				       in_len);
+		if (ret != 0)
+			break;
+		frames++;
+	}
+
+	if ((ret == 0) && (frames == 0U)) {
+		ERROR("lz4: no frame found\n");
+		ret = -EIO;
+	}
+
+	VERBOSE("lz4: %lu byte output\n",
+		(unsigned long)(out - (uint8_t *)*out_buf));
+
+	*out_buf = (uintptr_t)out;
+
+	return ret;
+}
@@ -251,6 +251,17 @@ endef
 
 GZIP_SUFFIX := .gz
 
+# LZ4 (frame format, 64 KiB blocks, with the content size for unlz4();
+# unlz4_stream() needs an input window as large as a block). Blocks are linked
+# unless LZ4_INDEPENDENT_BLOCKS=1, which lets unlz4() decode them in parallel.
+define LZ4_RULE
+$(1): $(2)
+	$(ECHO) "  LZ4     $$@"
+	$(Q)lz4 -q -f -9 -B4 $(if $(filter 1,$(LZ4_INDEPENDENT_BLOCKS)),-BI,-BD) --content-size $$< $$@
+endef
+
+LZ4_SUFFIX := .lz4
+
 ################################################################################
 # Auxiliary macros to build TF images from sources
 ################################################################################
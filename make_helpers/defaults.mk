@@ -42,6 +42,9 @@ BL2_IN_XIP_MEM			:= 0
 # Do dcache invalidate upon BL2 entry at EL3
 BL2_INV_DCACHE			:= 1
 
+# Load the next image while BL2 authenticates the current one
+BL2_PIPELINED_LOAD		:= 0
+
 # Select the branch protection features to use.
 BRANCH_PROTECTION		:= 0
 
@@ -163,6 +166,12 @@ ENABLE_FEAT_RNG			:= 0
 # Flag to enable Speculation Barrier Instruction
 ENABLE_FEAT_SB			:= 0
 
+# Flag to enable use of the SHA-256 instructions (FEAT_SHA256) by mbed TLS
+ENABLE_FEAT_SHA256		:= 0
+
+# Flag to enable use of the SHA-512 instructions (FEAT_SHA512) by mbed TLS
+ENABLE_FEAT_SHA512		:= 0
+
 # Flag to enable Secure EL-2 feature.
 ENABLE_FEAT_SEL2		:= 0
 
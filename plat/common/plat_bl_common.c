@@ -24,6 +24,10 @@
 #pragma weak bl2_plat_preload_setup
 #pragma weak bl2_plat_handle_pre_image_load
 #pragma weak bl2_plat_handle_post_image_load
+#if BL2_PIPELINED_LOAD
+#pragma weak bl2_plat_start_async_load
+#pragma weak bl2_plat_wait_async_load
+#endif
 #pragma weak plat_try_next_boot_source
 #pragma weak plat_get_enc_key_info
 #pragma weak plat_is_smccc_feature_available
@@ -69,6 +73,21 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 	return 0;
 }
 
+#if BL2_PIPELINED_LOAD
+/*
+ * Platforms whose storage driver can complete a read in the background arm it
+ * for the next image read here, and wait for that read in the second hook.
+ */
+void bl2_plat_start_async_load(unsigned int image_id)
+{
+}
+
+int bl2_plat_wait_async_load(unsigned int image_id)
+{
+	return 0;
+}
+#endif
+
 int plat_try_next_boot_source(void)
 {
 	return 0;
@@ -48,6 +48,9 @@ static console_t rzg2l_bl31_console;
 
 int bl2_plat_handle_pre_image_load(unsigned int image_id)
 {
+	RZ_BOOT_TL_IMAGE_START(image_id, RZ_BOOT_TL_IMAGE_LOAD);
+	rz_image_decompress_prepare(image_id);
+
 	return 0;
 }
 
@@ -55,12 +58,19 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
 	static bl2_to_bl31_params_mem_t *params;
 	bl_mem_params_node_t *bl_mem_params;
+	int ret;
 
 	if (!params) {
 		params = (bl2_to_bl31_params_mem_t *) PARAMS_BASE;
 		memset((void *)PARAMS_BASE, 0, sizeof(*params));
 	}
 
+	ret = rz_image_decompress(image_id);
+	if (ret != 0)
+		return ret;
+
+	RZ_BOOT_TL_IMAGE_END(image_id, RZ_BOOT_TL_IMAGE_LOAD);
+
 	bl_mem_params = get_bl_mem_params_node(image_id);
 
 	switch (image_id) {
@@ -71,6 +81,10 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 	case BL33_IMAGE_ID:
 		memcpy(&params->bl33_ep_info, &bl_mem_params->ep_info,
 			sizeof(entry_point_info_t));
+#if PLAT_BOOT_TIMELINE
+		/* BL33 is the last image BL2 loads */
+		rz_boot_timeline_report(params->boot_timeline);
+#endif
 		break;
 	default:
 		/* Do nothing in default case */
@@ -95,10 +109,14 @@ void bl2_el3_early_platform_setup(u_register_t arg1, u_register_t arg2,
 	generic_delay_timer_init();
 
 	/* setup PFC */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_PFC);
 	pfc_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_PFC);
 
 	/* setup Clock and Reset */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_CPG);
 	cpg_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_CPG);
 
 	/* USB 2.0 Phy workaround for RZ/G2L,LC	*/
 	if (((mmio_read_32(SYS_LSI_DEVID) & 0x0FFFFFFF) == 0x841C447) &&
@@ -129,6 +147,8 @@ void bl2_el3_early_platform_setup(u_register_t arg1, u_register_t arg2,
 
 	console_set_scope(&rzg2l_bl31_console,
 			CONSOLE_FLAG_BOOT | CONSOLE_FLAG_CRASH);
+
+	cpg_report();
 }
 
 void bl2_el3_plat_arch_setup(void)
@@ -154,8 +174,12 @@ void bl2_platform_setup(void)
 
 #if !DEBUG_FPGA
 	/* initialize DDR */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_DDR);
 	ddr_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_DDR);
 #endif /* DEBUG_FPGA */
 
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_IO_SETUP);
 	rz_io_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_IO_SETUP);
 }
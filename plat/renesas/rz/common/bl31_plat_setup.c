@@ -50,6 +50,11 @@ void bl31_early_platform_setup2(u_register_t arg0,
 
 	/* copy bl2_to_bl31_params_mem_t*/
 	memcpy(&from_bl2, (void *)arg0, sizeof(from_bl2));
+
+#if PLAT_BOOT_TIMELINE
+	rz_boot_timeline_restore(from_bl2.boot_timeline);
+#endif
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_BL31_SETUP);
 }
 
 void bl31_plat_arch_setup(void)
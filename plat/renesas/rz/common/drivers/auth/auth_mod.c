@@ -17,6 +17,7 @@
 #include "sblib/crypto_sblib.h"
 #include <drivers/auth/img_parser_mod.h>
 #include <plat/common/platform.h>
+#include <rz_boot_timeline.h>
 
 #define return_if_error(rc) \
 	do { \
@@ -92,6 +93,12 @@ static int auth_get_param(const auth_param_type_desc_t *param_type_desc,
  *
  * Crypto Module is not used because it does not fit the SB-Lib interface.
  *
+ * The key certificate is verified again for every image, even when several
+ * images are signed under the same key. SB-Lib only offers a single call that
+ * checks the key certificate, content certificate and image together, so a
+ * record of verified key certificates could not be used to skip any of its
+ * asymmetric operations.
+ *
  * Return:
  *   0 = success, Otherwise = error
  */
@@ -191,6 +198,8 @@ int auth_mod_verify_img(unsigned int img_id,
 	/* Get the image descriptor from the chain of trust */
 	img_desc = TBBR_COT_GETTER(img_id);
 
+	RZ_BOOT_TL_IMAGE_START(img_id, RZ_BOOT_TL_IMAGE_AUTH);
+
 	/* Ask the parser to check the image integrity */
 	rc = img_parser_check_integrity(img_desc->img_type, img_ptr, img_len);
 	return_if_error(rc);
@@ -248,5 +257,7 @@ int auth_mod_verify_img(unsigned int img_id,
 	/* Mark image as authenticated */
 	auth_img_flags[img_desc->img_id] |= IMG_FLAG_AUTHENTICATED;
 
+	RZ_BOOT_TL_IMAGE_END(img_id, RZ_BOOT_TL_IMAGE_AUTH);
+
 	return 0;
 }
@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <cpg_regs.h>
 #include <cpg.h>
+#include <common/debug.h>
 #include <lib/mmio.h>
 #include <drivers/delay_timer.h>
 #include <cpg_opt.h>
@@ -17,6 +18,13 @@
 #define CPG_T_CLK		(0)
 #define CPG_T_RST		(1)
 
+/* Most entries written before their monitors are polled together */
+#define CPG_BATCH_MAX		(64)
+/* Polling passes over a batch before a module is given up on */
+#define CPG_POLL_MAX		(100000U)
+/* Number of slowest modules kept for cpg_report() */
+#define CPG_SLOW_NUM		(3)
+
 typedef struct {
 	uintptr_t reg;
 	uintptr_t mon;
@@ -651,23 +659,92 @@ static CPG_REG_SETTING cpg_sel_gpu2_on_off[] = {
 };
 
 
-static void cpg_ctrl_clkrst(CPG_SETUP_DATA const *array, uint32_t num)
+static struct {
+	uintptr_t reg;
+	uint32_t polls;
+} cpg_slow[CPG_SLOW_NUM];
+
+static int cpg_settled(CPG_SETUP_DATA const *entry)
+{
+	uint32_t mask = (entry->val >> 16) & 0xFFFF;
+	uint32_t cmp = entry->val & 0xFFFF;
+
+	if (entry->type == CPG_T_RST) {
+		cmp = ~(cmp);
+	}
+
+	return (mmio_read_32(entry->mon) & mask) == (cmp & mask);
+}
+
+static void cpg_record_slow(uintptr_t reg, uint32_t polls)
 {
 	int i;
-	uint32_t mask;
-	uint32_t cmp;
 
-	for (i = 0; i < num; i++, array++) {
-		mmio_write_32(array->reg, array->val);
+	for (i = CPG_SLOW_NUM; (i > 0) && (cpg_slow[i - 1].polls < polls); i--) {
+		if (i < CPG_SLOW_NUM) {
+			cpg_slow[i] = cpg_slow[i - 1];
+		}
+	}
+
+	if (i < CPG_SLOW_NUM) {
+		cpg_slow[i].reg = reg;
+		cpg_slow[i].polls = polls;
+	}
+}
+
+/* Poll the monitors of array[0..num) until every one has settled */
+static void cpg_wait_batch(CPG_SETUP_DATA const *array, uint32_t num)
+{
+	uint64_t pending = (num == CPG_BATCH_MAX) ? ~0ULL : ((1ULL << num) - 1);
+	uint32_t polls = 0;
+	uint32_t i;
+
+	while (pending != 0) {
+		for (i = 0; i < num; i++) {
+			if (((pending >> i) & 1) && cpg_settled(&array[i])) {
+				pending &= ~(1ULL << i);
+				cpg_record_slow(array[i].reg, polls);
+			}
+		}
+
+		if ((pending != 0) && (++polls > CPG_POLL_MAX)) {
+			i = __builtin_ctzll(pending);
+			ERROR("CPG: 0x%lx did not settle (monitor 0x%lx = 0x%x)\n",
+			      array[i].reg, array[i].mon,
+			      mmio_read_32(array[i].mon));
+			panic();
+		}
+	}
+}
+
+/*
+ * Issue the writes of a table back to back and poll their monitors together.
+ * A batch ends where the type changes, so that resets are only released once
+ * the clocks listed before them are running, and before a register is
+ * written a second time.
+ */
+static void cpg_ctrl_clkrst(CPG_SETUP_DATA const *array, uint32_t num)
+{
+	uint32_t first = 0;
+	uint32_t i, j;
+
+	for (i = 0; i < num; i++) {
+		for (j = first; j < i; j++) {
+			if (array[j].reg == array[i].reg) {
+				break;
+			}
+		}
 
-		mask = (array->val >> 16) & 0xFFFF;
-		cmp = array->val & 0xFFFF;
-		if (array->type == CPG_T_RST) {
-			cmp = ~(cmp);
+		if ((i > first) && ((i - first == CPG_BATCH_MAX) || (j < i) ||
+				    (array[i].type != array[first].type))) {
+			cpg_wait_batch(&array[first], i - first);
+			first = i;
 		}
-		while ((mmio_read_32(array->mon) & mask) != (cmp & mask))
-			;
+
+		mmio_write_32(array[i].reg, array[i].val);
 	}
+
+	cpg_wait_batch(&array[first], num - first);
 }
 
 static void cpg_selector_on_off(uint32_t sel, uint8_t flag)
@@ -909,6 +986,17 @@ void cpg_wdtrst_sel_setup(void)
 	mmio_write_32(CPG_WDTRST_SEL, reg);
 }
 
+/* Report the modules whose monitors took longest to settle */
+void cpg_report(void)
+{
+	int i;
+
+	for (i = 0; (i < CPG_SLOW_NUM) && (cpg_slow[i].reg != 0); i++) {
+		INFO("BL2: CPG slowest %d: 0x%lx, %u polls\n", i + 1,
+		     cpg_slow[i].reg, cpg_slow[i].polls);
+	}
+}
+
 void cpg_setup(void)
 {
 	cpg_selector_on_off(CPG_SEL_PLL3_3_ON_OFF, CPG_OFF);
@@ -18,6 +18,24 @@
 #define	MAX_BYTE_LANES		(2U)
 #define	MAX_BEST_VREF_SAVED	(30U)
 #define	VREF_SETP			(1U)
+#define	VREF_COARSE_STEP	((uint32_t)PLAT_DDR_VREF_COARSE_STEP)
+#define	VREF_MAX_CODE		(127U)
+
+/* State of one VREF search, see vref_search() */
+struct vref_sweep {
+	uint32_t	lo;
+	uint32_t	hi;
+	uint32_t	sl_lanes;
+	uint32_t	byte_lanes;
+	uint8_t		cs;
+	const char	*side;
+	uint32_t	runs;
+	uint32_t	tried[CEIL(VREF_MAX_CODE + 1U, 32U)];
+	uint32_t	best_window_diff_so_far[MAX_BYTE_LANES];
+	uint32_t	num_best_vref_matches[MAX_BYTE_LANES];
+	uint32_t	all_best_vref_matches[MAX_BYTE_LANES][MAX_BEST_VREF_SAVED];
+	void		(*train)(struct vref_sweep *sweep, uint16_t current_vref);
+};
 
 extern const uint32_t mc_init_tbl[MC_INIT_NUM][2];
 extern const uint32_t mc_odt_pins_tbl[4];
@@ -37,6 +55,9 @@ static void program_mc1(uint8_t *lp_auto_entry_en);
 static void program_phy1(uint32_t sl_lanes, uint32_t byte_lanes);
 static void exec_trainingWRLVL(uint32_t sl_lanes);
 static void exec_trainingVREF(uint32_t sl_lanes, uint32_t byte_lanes);
+static void vref_search(struct vref_sweep *sweep);
+static void vref_train_phy(struct vref_sweep *sweep, uint16_t current_vref);
+static void vref_train_dram(struct vref_sweep *sweep, uint16_t current_vref);
 static void setup_vref_training_registers(uint8_t vref_value, uint8_t cs, uint8_t turn_on_off_vref_training);
 static void write_mr(uint8_t cs, uint8_t mrw_sel, uint16_t mrw_data);
 static void exec_trainingBITLVL(uint32_t sl_lanes);
@@ -495,13 +516,9 @@ static void exec_trainingWRLVL(uint32_t sl_lanes)
 static void exec_trainingVREF(uint32_t sl_lanes, uint32_t byte_lanes)
 {
 	uint32_t vref_mid_level_code;
-	uint32_t vref_training_value;
 	uint32_t sweep_range;
 	uint16_t current_vref = 0;
-	uint32_t best_window_diff_so_far[MAX_BYTE_LANES];
-	uint32_t num_best_vref_matches[MAX_BYTE_LANES];
-	uint32_t all_best_vref_matches[MAX_BYTE_LANES][MAX_BEST_VREF_SAVED];
-	uint8_t window_0, window_1, window_diff;
+	struct vref_sweep sweep;
 	uint32_t highest_best_vref_val, lowest_best_vref_val;
 	uint8_t orig_cs_config;
 	uint32_t tmp;
@@ -517,79 +534,30 @@ static void exec_trainingVREF(uint32_t sl_lanes, uint32_t byte_lanes)
 	sweep_range = read_mc_reg(DDRMC_R043) & 0xFF;
 
 	// Step4
-	for (i = 0; i < byte_lanes; i++) {
-		best_window_diff_so_far[i] = 255;
-		num_best_vref_matches[i] = 0;
-	}
+	sweep.lo = (vref_mid_level_code < sweep_range + 2) ?
+				2 : vref_mid_level_code - sweep_range;
+	sweep.hi = _MAX(vref_mid_level_code, _MIN(vref_mid_level_code + sweep_range, 126));
+	sweep.sl_lanes = sl_lanes;
+	sweep.byte_lanes = byte_lanes;
+	sweep.side = "PHY";
+	sweep.train = vref_train_phy;
 
 	// Step5
-	for (vref_training_value = 0;
-		 vref_training_value < (sweep_range * 2) + 1;
-		 vref_training_value += VREF_SETP) {
-		// Step5.1
-		if (vref_training_value < sweep_range + 1) {
-			if (vref_mid_level_code < vref_training_value + 2) {
-				vref_training_value = sweep_range;
-				continue;
-			} else {
-				current_vref = vref_mid_level_code - vref_training_value;
-			}
-		} else {
-			if ((vref_mid_level_code + vref_training_value - sweep_range) > 126) {
-				break;
-			} else {
-				current_vref = vref_mid_level_code + vref_training_value - sweep_range;
-			}
-		}
-		for (i = 0; i < byte_lanes; i++) {
-			write_phy_reg(DDRPHY_R29, 7 * i);
-			write_phy_reg(DDRPHY_R66, (current_vref << 4) | 0x00000001);
-		}
-
-		// Step5.2
-		write_phy_reg(DDRPHY_R18, 0x30800000);
-		while ((read_phy_reg(DDRPHY_R18) & 0x10000000) != 0x00000000)
-			;
-
-		// Step5.3
-		for (i = 0; i < byte_lanes; i++) {
-			if (((read_phy_reg(DDRPHY_R59) >> (14 + i)) & 0x1) == 0x0) {
-				INFO("BL2: PHY side VREF training passed on lane %0d, current_vref = %0d\n", i, current_vref);
-				write_phy_reg(DDRPHY_R29, i * 6);
-				window_0 = read_phy_reg(DDRPHY_R69) & 0x3F;
-				window_1 = (read_phy_reg(DDRPHY_R69) >> 8) & 0x3F;
-				window_diff = (window_0 > window_1) ?
-								window_0 - window_1 : window_1 - window_0;
-				INFO("BL2: window_0 = %0d, window_1 = %0d, window_diff = %0d\n", window_0, window_1, window_diff);
-				if (window_diff < best_window_diff_so_far[i]) {
-					best_window_diff_so_far[i] = window_diff;
-					all_best_vref_matches[i][0] = current_vref;
-					num_best_vref_matches[i] = 1;
-					INFO("BL2: CURRENT BEST VREF PHY side :%d\n", current_vref);
-				} else if ((window_diff == best_window_diff_so_far[i]) &&
-						(num_best_vref_matches[i] < MAX_BEST_VREF_SAVED)) {
-					all_best_vref_matches[i][num_best_vref_matches[i]] = current_vref;
-					num_best_vref_matches[i] += 1;
-				}
-			} else {
-				INFO("BL2: PHY side VREF training failed lane %d, current_vref = %d\n",
-					i, current_vref);
-			}
-		}
-		// Step5.4
-	}
+	vref_search(&sweep);
 
 	// Step6
 	for (i = 0; i < byte_lanes; i++) {
 		highest_best_vref_val = 0x0;
 		lowest_best_vref_val = 0x7F;
-		for (j = 0; j < num_best_vref_matches[i]; j++) {
+		for (j = 0; j < sweep.num_best_vref_matches[i]; j++) {
 			highest_best_vref_val =
-				_MAX(all_best_vref_matches[i][j], highest_best_vref_val);
+				_MAX(sweep.all_best_vref_matches[i][j], highest_best_vref_val);
 			lowest_best_vref_val  =
-				_MIN(all_best_vref_matches[i][j], lowest_best_vref_val);
+				_MIN(sweep.all_best_vref_matches[i][j], lowest_best_vref_val);
 		}
 		current_vref = (highest_best_vref_val + lowest_best_vref_val) >> 1;
+		INFO("BL2: PHY side VREF lane %d = %d after %d training runs\n",
+			i, current_vref, sweep.runs);
 		write_phy_reg(DDRPHY_R29, 7 * i);
 		write_phy_reg(DDRPHY_R66, current_vref << 4);
 	}
@@ -626,78 +594,30 @@ static void exec_trainingVREF(uint32_t sl_lanes, uint32_t byte_lanes)
 	rmw_phy_reg(DDRPHY_R66, 0xFFFFFFFE, 0x00000001);
 
 	// Step15
-	for (i = 0; i < byte_lanes; i++) {
-		best_window_diff_so_far[i] = 255;
-		num_best_vref_matches[i] = 0;
-	}
+	sweep.lo = (vref_mid_level_code < sweep_range) ?
+				0 : vref_mid_level_code - sweep_range;
+	sweep.hi = _MAX(vref_mid_level_code, _MIN(vref_mid_level_code + sweep_range, 73));
+	sweep.cs = orig_cs_config;
+	sweep.side = "DRAM";
+	sweep.train = vref_train_dram;
 
 	// Step16
-	for (vref_training_value = 0;
-		 vref_training_value < (sweep_range * 2) + 1;
-		 vref_training_value += VREF_SETP) {
-		// Step16.1
-		if (vref_training_value < (sweep_range + 1)) {
-			if (vref_training_value > vref_mid_level_code) {
-				vref_training_value = sweep_range;
-				continue;
-			} else {
-				current_vref = vref_mid_level_code - vref_training_value;
-			}
-		} else {
-			if ((vref_mid_level_code + vref_training_value - sweep_range) <= 73) {
-				current_vref =
-					vref_mid_level_code + vref_training_value - sweep_range;
-			} else {
-				break;
-			}
-		}
-		setup_vref_training_registers(current_vref, orig_cs_config, 0);
-
-		// Step16.2
-		write_phy_reg(DDRPHY_R18, 0x30500000);
-		while ((read_phy_reg(DDRPHY_R18) & 0x10000000) != 0x00000000)
-			;
-
-		// Step16.3
-		tmp = (read_phy_reg(DDRPHY_R64) >> 20) & sl_lanes;
-		for (i = 0; i < byte_lanes; i++) {
-			if ((tmp ^ sl_lanes) == sl_lanes) {
-				INFO("BL2: VREF training passed during VrefDQ training DRAM side, current_vref = %d\n", current_vref);
-				write_phy_reg(DDRPHY_R29, i * 6);
-				window_0 = read_phy_reg(DDRPHY_R69) & 0x3F;
-				window_1 = (read_phy_reg(DDRPHY_R69) >> 8) & 0x3F;
-				window_diff = (window_0 > window_1) ?
-								window_0 - window_1 : window_1 - window_0;
-				INFO("BL2: window_0 = %0d, window_1 = %0d, window_diff = %0d\n", window_0, window_1, window_diff);
-				if (window_diff < best_window_diff_so_far[i]) {
-					best_window_diff_so_far[i] = window_diff;
-					all_best_vref_matches[i][0] = current_vref;
-					num_best_vref_matches[i] = 1;
-					INFO("BL2: CURRENT BEST VREF DRAM side :%d\n", current_vref);
-				} else if ((window_diff == best_window_diff_so_far[i]) &&
-						(num_best_vref_matches[i] < MAX_BEST_VREF_SAVED)) {
-					all_best_vref_matches[i][num_best_vref_matches[i]] = current_vref;
-					num_best_vref_matches[i] += 1;
-				}
-			} else {
-				INFO("BL2: VREF training failed during VrefDQ training DRAM side, current_vref = %d\n", current_vref);
-			}
-		}
-		// Step16.4
-	}
+	vref_search(&sweep);
 
 	// Step17
 	highest_best_vref_val = 0x0;
 	lowest_best_vref_val = 0x7F;
 	for (i = 0; i < byte_lanes; i++) {
-		for (j = 0; j < num_best_vref_matches[i]; j++) {
+		for (j = 0; j < sweep.num_best_vref_matches[i]; j++) {
 			highest_best_vref_val =
-				_MAX(all_best_vref_matches[i][j], highest_best_vref_val);
+				_MAX(sweep.all_best_vref_matches[i][j], highest_best_vref_val);
 			lowest_best_vref_val  =
-				_MIN(all_best_vref_matches[i][j], lowest_best_vref_val);
+				_MIN(sweep.all_best_vref_matches[i][j], lowest_best_vref_val);
 		}
 	}
 	current_vref = (highest_best_vref_val + lowest_best_vref_val) >> 1;
+	INFO("BL2: DRAM side VREF = %d after %d training runs\n",
+		current_vref, sweep.runs);
 
 	// Step18
 	setup_vref_training_registers(current_vref, sl_lanes, 0);
@@ -721,6 +641,133 @@ static void exec_trainingVREF(uint32_t sl_lanes, uint32_t byte_lanes)
 	}
 }
 
+static void vref_record_window(struct vref_sweep *sweep, uint32_t lane, uint16_t current_vref)
+{
+	uint8_t window_0, window_1, window_diff;
+
+	write_phy_reg(DDRPHY_R29, lane * 6);
+	window_0 = read_phy_reg(DDRPHY_R69) & 0x3F;
+	window_1 = (read_phy_reg(DDRPHY_R69) >> 8) & 0x3F;
+	window_diff = (window_0 > window_1) ?
+					window_0 - window_1 : window_1 - window_0;
+	INFO("BL2: window_0 = %0d, window_1 = %0d, window_diff = %0d\n", window_0, window_1, window_diff);
+	if (window_diff < sweep->best_window_diff_so_far[lane]) {
+		sweep->best_window_diff_so_far[lane] = window_diff;
+		sweep->all_best_vref_matches[lane][0] = current_vref;
+		sweep->num_best_vref_matches[lane] = 1;
+		INFO("BL2: CURRENT BEST VREF %s side :%d\n", sweep->side, current_vref);
+	} else if ((window_diff == sweep->best_window_diff_so_far[lane]) &&
+			(sweep->num_best_vref_matches[lane] < MAX_BEST_VREF_SAVED)) {
+		sweep->all_best_vref_matches[lane][sweep->num_best_vref_matches[lane]] = current_vref;
+		sweep->num_best_vref_matches[lane] += 1;
+	}
+}
+
+static void vref_train_phy(struct vref_sweep *sweep, uint16_t current_vref)
+{
+	int i;
+
+	for (i = 0; i < sweep->byte_lanes; i++) {
+		write_phy_reg(DDRPHY_R29, 7 * i);
+		write_phy_reg(DDRPHY_R66, (current_vref << 4) | 0x00000001);
+	}
+
+	write_phy_reg(DDRPHY_R18, 0x30800000);
+	while ((read_phy_reg(DDRPHY_R18) & 0x10000000) != 0x00000000)
+		;
+
+	for (i = 0; i < sweep->byte_lanes; i++) {
+		if (((read_phy_reg(DDRPHY_R59) >> (14 + i)) & 0x1) == 0x0) {
+			INFO("BL2: PHY side VREF training passed on lane %0d, current_vref = %0d\n", i, current_vref);
+			vref_record_window(sweep, i, current_vref);
+		} else {
+			INFO("BL2: PHY side VREF training failed lane %d, current_vref = %d\n",
+				i, current_vref);
+		}
+	}
+}
+
+static void vref_train_dram(struct vref_sweep *sweep, uint16_t current_vref)
+{
+	uint32_t tmp;
+	int i;
+
+	setup_vref_training_registers(current_vref, sweep->cs, 0);
+
+	write_phy_reg(DDRPHY_R18, 0x30500000);
+	while ((read_phy_reg(DDRPHY_R18) & 0x10000000) != 0x00000000)
+		;
+
+	tmp = (read_phy_reg(DDRPHY_R64) >> 20) & sweep->sl_lanes;
+	for (i = 0; i < sweep->byte_lanes; i++) {
+		if ((tmp ^ sweep->sl_lanes) == sweep->sl_lanes) {
+			INFO("BL2: VREF training passed during VrefDQ training DRAM side, current_vref = %d\n", current_vref);
+			vref_record_window(sweep, i, current_vref);
+		} else {
+			INFO("BL2: VREF training failed during VrefDQ training DRAM side, current_vref = %d\n", current_vref);
+		}
+	}
+}
+
+static void vref_try(struct vref_sweep *sweep, uint32_t current_vref)
+{
+	uint32_t bit = 1U << (current_vref % 32U);
+
+	if ((sweep->tried[current_vref / 32U] & bit) != 0U)
+		return;
+
+	sweep->tried[current_vref / 32U] |= bit;
+	sweep->runs++;
+	sweep->train(sweep, current_vref);
+}
+
+/*
+ * Train every VREF_COARSE_STEP-th value of [lo, hi], then every value within
+ * one coarse step of the best coarse values of all lanes. When the best values
+ * of a lane form one region this finds the same set as a full sweep, so the
+ * selection rule of the callers is unchanged. A lane without a passing coarse
+ * value falls back to the full sweep; PLAT_DDR_VREF_COARSE_STEP=1 always does.
+ */
+static void vref_search(struct vref_sweep *sweep)
+{
+	uint32_t current_vref, lo, hi;
+	int i, j;
+
+	sweep->runs = 0;
+	for (i = 0; i < ARRAY_SIZE(sweep->tried); i++)
+		sweep->tried[i] = 0;
+	for (i = 0; i < sweep->byte_lanes; i++) {
+		sweep->best_window_diff_so_far[i] = 255;
+		sweep->num_best_vref_matches[i] = 0;
+	}
+
+	// Coarse grid, always including both ends
+	for (current_vref = sweep->lo; current_vref < sweep->hi;
+		 current_vref += VREF_COARSE_STEP)
+		vref_try(sweep, current_vref);
+	vref_try(sweep, sweep->hi);
+
+	// Fine window around the best coarse values
+	lo = sweep->hi;
+	hi = sweep->lo;
+	for (i = 0; i < sweep->byte_lanes; i++) {
+		if (sweep->num_best_vref_matches[i] == 0) {
+			lo = sweep->lo;
+			hi = sweep->hi;
+			break;
+		}
+		for (j = 0; j < sweep->num_best_vref_matches[i]; j++) {
+			lo = _MIN(sweep->all_best_vref_matches[i][j], lo);
+			hi = _MAX(sweep->all_best_vref_matches[i][j], hi);
+		}
+	}
+	lo = (lo < sweep->lo + VREF_COARSE_STEP - 1) ? sweep->lo : lo - (VREF_COARSE_STEP - 1);
+	hi = _MIN(hi + VREF_COARSE_STEP - 1, sweep->hi);
+
+	for (current_vref = lo; current_vref <= hi; current_vref += VREF_SETP)
+		vref_try(sweep, current_vref);
+}
+
 static void setup_vref_training_registers(uint8_t vref_value, uint8_t cs, uint8_t turn_on_off_vref_training)
 {
 	uint8_t vref_op_code;
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/delay_timer.h>
+#include <lib/mmio.h>
+
+#include <rz_soc_def.h>
+#include <dmac.h>
+
+/* Channel 0 of the first channel group, register mode, software trigger */
+#define DMAC_CH						(0U)
+#define DMAC_CH_BASE				(RZ_SOC_DMAC_BASE + (DMAC_CH * 0x40U))
+#define DMAC_GRP_BASE				(RZ_SOC_DMAC_BASE + 0x0300U)
+
+#define DMAC_N0SA					(DMAC_CH_BASE + 0x0000U)	/* Next0 source address */
+#define DMAC_N0DA					(DMAC_CH_BASE + 0x0004U)	/* Next0 destination address */
+#define DMAC_N0TB					(DMAC_CH_BASE + 0x0008U)	/* Next0 transaction byte */
+#define DMAC_CHSTAT					(DMAC_CH_BASE + 0x0024U)	/* Channel status */
+#define DMAC_CHCTRL					(DMAC_CH_BASE + 0x0028U)	/* Channel control */
+#define DMAC_CHCFG					(DMAC_CH_BASE + 0x002CU)	/* Channel configuration */
+#define DMAC_CHITVL					(DMAC_CH_BASE + 0x0030U)	/* Channel interval */
+#define DMAC_CHEXT					(DMAC_CH_BASE + 0x0034U)	/* Channel extension */
+#define DMAC_DCTRL					(DMAC_GRP_BASE + 0x0000U)	/* DMA control */
+
+#define CHSTAT_EN					(1U << 0)
+#define CHSTAT_ER					(1U << 4)
+#define CHSTAT_END					(1U << 5)
+
+#define CHCTRL_SETEN				(1U << 0)
+#define CHCTRL_CLREN				(1U << 1)
+#define CHCTRL_STG					(1U << 2)
+#define CHCTRL_SWRST				(1U << 3)
+#define CHCTRL_CLRRQ				(1U << 4)
+#define CHCTRL_CLREND				(1U << 5)
+#define CHCTRL_CLRTC				(1U << 6)
+#define CHCTRL_CLRSUS				(1U << 9)
+#define CHCTRL_CLRINTMSK			(1U << 17)
+#define CHCTRL_CLEAR				(CHCTRL_CLRINTMSK | CHCTRL_CLRSUS | CHCTRL_CLRTC | \
+									 CHCTRL_CLREND | CHCTRL_CLRRQ | CHCTRL_SWRST | \
+									 CHCTRL_CLREN)
+
+#define CHCFG_SEL(ch)				((ch) & 0x7U)
+#define CHCFG_REQD					(1U << 3)
+#define CHCFG_SDS_64BIT				(3U << 12)
+#define CHCFG_DDS_64BIT				(3U << 16)
+#define CHCFG_TM_BLOCK				(1U << 22)
+#define CHCFG_DEM					(1U << 24)
+#define CHCFG_MEM_COPY				(CHCFG_SEL(DMAC_CH) | CHCFG_REQD | CHCFG_SDS_64BIT | \
+									 CHCFG_DDS_64BIT | CHCFG_TM_BLOCK | CHCFG_DEM)
+
+/* Secure privileged data accesses on both sides (AxPROT = 0b001) */
+#define CHEXT_SPR_SECURE			(1U << 0)
+#define CHEXT_DPR_SECURE			(1U << 8)
+
+#define DCTRL_PR					(1U << 0)
+#define DCTRL_LVINT					(1U << 1)
+
+#define DMAC_N0TB_MAX				(0xFFFFFFFFU & ~(DMAC_ALIGN - 1U))
+#define DMAC_ADDR_LIMIT				(0x100000000ULL)
+#define DMAC_TIMEOUT_US				(1000000U)
+#define DMAC_CLEAR_TIMEOUT_US		(1000U)
+
+/* Stop and reset the channel, failing if it does not come to a halt */
+static int32_t dmac_ch_clear(void)
+{
+	uint32_t timeout = DMAC_CLEAR_TIMEOUT_US;
+
+	mmio_write_32(DMAC_CHCTRL, CHCTRL_CLEAR);
+	while ((mmio_read_32(DMAC_CHSTAT) & CHSTAT_EN) != 0U) {
+		if (timeout-- == 0U) {
+			WARN("BL2: DMAC channel %u does not stop\n", DMAC_CH);
+			return DMAC_ERROR;
+		}
+		udelay(1);
+	}
+
+	return DMAC_SUCCESS;
+}
+
+/*
+ * Start copying len bytes with a single block transfer and return without
+ * waiting for it. The caller keeps the CPU caches coherent with the
+ * destination and must call dmac_copy_wait() before starting another copy.
+ */
+int32_t dmac_copy_start(uintptr_t dst, uintptr_t src, size_t len)
+{
+	if ((len == 0U) || (len > DMAC_N0TB_MAX) ||
+	    (((dst | src | len) & (DMAC_ALIGN - 1U)) != 0U) ||
+	    (((unsigned long long)dst + len) > DMAC_ADDR_LIMIT) ||
+	    (((unsigned long long)src + len) > DMAC_ADDR_LIMIT)) {
+		return DMAC_ERROR;
+	}
+
+	/* A channel left running by an earlier failure must be stopped first */
+	if (((mmio_read_32(DMAC_CHSTAT) & CHSTAT_EN) != 0U) &&
+	    (dmac_ch_clear() != DMAC_SUCCESS)) {
+		return DMAC_ERROR;
+	}
+
+	mmio_write_32(DMAC_N0SA, (uint32_t)src);
+	mmio_write_32(DMAC_N0DA, (uint32_t)dst);
+	mmio_write_32(DMAC_N0TB, (uint32_t)len);
+	mmio_write_32(DMAC_CHCFG, CHCFG_MEM_COPY);
+	mmio_write_32(DMAC_CHITVL, 0);
+	mmio_write_32(DMAC_CHEXT, CHEXT_SPR_SECURE | CHEXT_DPR_SECURE);
+	dsbsy();
+
+	mmio_write_32(DMAC_CHCTRL, CHCTRL_SWRST);
+	mmio_write_32(DMAC_CHCTRL, CHCTRL_SETEN | CHCTRL_STG);
+
+	return DMAC_SUCCESS;
+}
+
+/*
+ * Wait for the copy started by dmac_copy_start(). On error the channel is
+ * reset and DMAC_ERROR returned so that the caller can fall back to the CPU.
+ */
+int32_t dmac_copy_wait(void)
+{
+	uint32_t stat;
+	uint32_t timeout = DMAC_TIMEOUT_US;
+	int32_t ret;
+
+	do {
+		stat = mmio_read_32(DMAC_CHSTAT);
+		if ((stat & (CHSTAT_END | CHSTAT_ER)) != 0U) {
+			break;
+		}
+		udelay(1);
+	} while (--timeout != 0U);
+
+	ret = dmac_ch_clear();
+
+	if ((ret != DMAC_SUCCESS) || ((stat & CHSTAT_ER) != 0U) ||
+	    (timeout == 0U)) {
+		WARN("BL2: DMAC transfer failed (CHSTAT 0x%x)\n", stat);
+		return DMAC_ERROR;
+	}
+
+	return DMAC_SUCCESS;
+}
+
+/* Copy len bytes with a single block transfer and wait for it */
+int32_t dmac_copy(uintptr_t dst, uintptr_t src, size_t len)
+{
+	if (dmac_copy_start(dst, src, len) != DMAC_SUCCESS) {
+		return DMAC_ERROR;
+	}
+
+	return dmac_copy_wait();
+}
+
+int32_t dmac_init(void)
+{
+	mmio_write_32(DMAC_DCTRL, DCTRL_LVINT | DCTRL_PR);
+
+	return dmac_ch_clear();
+}
@@ -157,6 +157,10 @@ static void emmc_WaitCmd2Cmd_8Cycle(void)
 
 static void cmdErrSdInfo2Log(void)
 {
+	/* failing sampling taps are expected while tuning */
+	if (mmc_drv_obj.tuning_flag == TRUE)
+		return;
+
 	ERROR("BL2: emmc ERR SD_INFO2 = 0x%x\n", mmc_drv_obj.error_info.info2);
 }
 
@@ -458,6 +462,8 @@ EMMC_ERROR_CODE emmc_exec_cmd(uint32_t error_mask, uint32_t *response)
 		case ESTATE_ERROR:
 			if (err_not_care_flag == TRUE) {
 				mmc_drv_obj.during_cmd_processing = FALSE;
+			} else if (mmc_drv_obj.tuning_flag == TRUE) {
+				emmc_softreset();
 			} else {
 				emmc_softreset();
 				emmc_write_error_info(EMMC_FUNCNO_EXEC_CMD,
@@ -478,7 +484,9 @@ EMMC_ERROR_CODE emmc_exec_cmd(uint32_t error_mask, uint32_t *response)
 		if (mmc_drv_obj.during_dma_transfer == TRUE) {
 			mmc_drv_obj.during_dma_transfer = FALSE;
 		}
-		ERROR("BL2: emmc exec_cmd:EMMC_ERR_FORCE_TERMINATE\n");
+		if (mmc_drv_obj.tuning_flag != TRUE) {
+			ERROR("BL2: emmc exec_cmd:EMMC_ERR_FORCE_TERMINATE\n");
+		}
 		emmc_softreset();
 
 		return EMMC_ERR_FORCE_TERMINATE; /* error information has already been written. */
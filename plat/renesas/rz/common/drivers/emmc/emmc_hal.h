@@ -295,7 +295,11 @@ typedef enum {
 	    (uint32_t)HAL_MEMCARD_COMMAND_CARD_TYPE_MMC |
 	    (uint32_t)HAL_MEMCARD_COMMAND_NORMAL,
 	/* CMD21 */
-	CMD21 = 21U,
+	CMD21_SEND_TUNING_BLOCK =
+	    21U | (uint32_t)HAL_MEMCARD_RESPONSE_R1 |
+	    (uint32_t)HAL_MEMCARD_COMMAND_TYPE_ADTC_READ |
+	    (uint32_t)HAL_MEMCARD_COMMAND_CARD_TYPE_MMC |
+	    (uint32_t)HAL_MEMCARD_COMMAND_NORMAL,
 	/* CMD22 */
 	CMD22 = 22U,
 	ACMD22_SEND_NUM_WR_BLOCKS =
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <string.h>
+
 #include <common/debug.h>
 #include <lib/mmio.h>
 #include <drivers/delay_timer.h>
@@ -22,6 +24,14 @@ static void set_sd_clk(uint32_t clkDiv);
 static uint32_t emmc_calc_tran_speed(uint32_t *freq);
 static void emmc_get_partition_access(void);
 static void emmc_set_bootpartition(void);
+#if PLAT_EMMC_BUS_MODE != EMMC_BUS_MODE_HS52
+static EMMC_ERROR_CODE emmc_select_hs200(void);
+#if PLAT_EMMC_BUS_MODE == EMMC_BUS_MODE_HS400
+static EMMC_ERROR_CODE emmc_select_hs400(void);
+#endif
+static EMMC_ERROR_CODE emmc_fallback_hs52(void);
+#endif
+static void emmc_report_bus_mode(void);
 
 static void emmc_set_bootpartition(void)
 {
@@ -364,6 +374,304 @@ EXIT:
 	return result;
 }
 
+#if PLAT_EMMC_BUS_MODE != EMMC_BUS_MODE_HS52
+/* JEDEC tuning block pattern for an 8-bit bus */
+static const uint8_t emmc_tuning_pattern[EMMC_TUNING_BLOCK_LENGTH] = {
+	0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0xff, 0xff, 0xcc, 0xcc, 0xcc, 0x33, 0xcc, 0xcc,
+	0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xff, 0xff,
+	0xff, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee, 0xff,
+	0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xdd, 0xdd,
+	0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xbb,
+	0xbb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff,
+	0x77, 0x77, 0xff, 0x77, 0xbb, 0xdd, 0xee, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0x33, 0xcc,
+	0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xff,
+	0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee,
+	0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xdd,
+	0xdd, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff,
+	0xbb, 0xbb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff,
+	0xff, 0x77, 0x77, 0xff, 0x77, 0xbb, 0xdd, 0xee
+};
+
+static uint8_t emmc_tuning_buf[EMMC_TUNING_BLOCK_LENGTH]
+	__attribute__ ((aligned(EMMC_BUF_REG_ALIGNED)));
+
+static EMMC_ERROR_CODE emmc_set_data_clock(uint32_t freq)
+{
+	EMMC_ERROR_CODE result;
+
+	/* set mmc clock */
+	mmc_drv_obj.max_freq = freq;
+	result = emmc_set_request_mmc_clock(&freq);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	/* set read/write timeout */
+	mmc_drv_obj.data_timeout = emmc_set_timeout_register_value(freq);
+	SETR_32(SD_OPTION,
+		((GETR_32(SD_OPTION) & ~(SD_OPTION_TIMEOUT_CNT_MASK)) |
+		 mmc_drv_obj.data_timeout));
+
+	return EMMC_SUCCESS;
+}
+
+static EMMC_ERROR_CODE emmc_switch(uint32_t arg)
+{
+	/* CMD6 */
+	emmc_make_nontrans_cmd(CMD6_SWITCH, arg);
+	return emmc_exec_cmd(EMMC_R1_ERROR_MASK, mmc_drv_obj.response);
+}
+
+static EMMC_ERROR_CODE emmc_send_status(void)
+{
+	/* CMD13 */
+	emmc_make_nontrans_cmd(CMD13_SEND_STATUS, EMMC_RCA << 16);
+	return emmc_exec_cmd(EMMC_R1_ERROR_MASK, mmc_drv_obj.response);
+}
+
+static void emmc_scc_enable(void)
+{
+	/* the sampling clock may only be switched with SDCLK stopped */
+	(void)emmc_clock_ctrl(FALSE);
+	SETR_32(SCC_DTCNTL, (GETR_32(SCC_DTCNTL) | SCC_DTCNTL_TAPEN));
+	SETR_32(SCC_CKSEL, (GETR_32(SCC_CKSEL) | SCC_CKSEL_DTSEL));
+	(void)emmc_clock_ctrl(TRUE);
+
+	SETR_32(SCC_RVSCNTL, (GETR_32(SCC_RVSCNTL) & ~SCC_RVSCNTL_RVSEN));
+	SETR_32(SCC_DT2FF, SCC_DT2FF_TAPPOS);
+}
+
+static void emmc_scc_disable(void)
+{
+	(void)emmc_clock_ctrl(FALSE);
+	SETR_32(SCC_TMPPORT2, (GETR_32(SCC_TMPPORT2) &
+			       ~(SCC_TMPPORT2_HS400OSEL | SCC_TMPPORT2_HS400EN)));
+	SETR_32(SDIF_MODE, (GETR_32(SDIF_MODE) & ~SDIF_MODE_HS400));
+	SETR_32(SCC_CKSEL, (GETR_32(SCC_CKSEL) & ~SCC_CKSEL_DTSEL));
+	SETR_32(SCC_DTCNTL, (GETR_32(SCC_DTCNTL) & ~SCC_DTCNTL_TAPEN));
+	(void)emmc_clock_ctrl(TRUE);
+
+	SETR_32(SCC_RVSCNTL, (GETR_32(SCC_RVSCNTL) & ~SCC_RVSCNTL_RVSEN));
+}
+
+static EMMC_ERROR_CODE emmc_send_tuning(void)
+{
+	EMMC_ERROR_CODE result;
+
+	memset(emmc_tuning_buf, 0, sizeof(emmc_tuning_buf));
+
+	/* CMD21 */
+	emmc_make_trans_cmd(CMD21_SEND_TUNING_BLOCK, 0x00000000,
+			    (uint32_t *) emmc_tuning_buf,
+			    EMMC_TUNING_BLOCK_LENGTH, HAL_MEMCARD_READ,
+			    HAL_MEMCARD_NOT_DMA);
+	result = emmc_exec_cmd(EMMC_R1_ERROR_MASK, mmc_drv_obj.response);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	if (memcmp(emmc_tuning_buf, emmc_tuning_pattern,
+		   EMMC_TUNING_BLOCK_LENGTH) != 0) {
+		return EMMC_ERR_TRANSFER;
+	}
+
+	return EMMC_SUCCESS;
+}
+
+static EMMC_ERROR_CODE emmc_execute_tuning(void)
+{
+	uint32_t tap_num, ntap, i;
+	uint32_t good_taps = 0U;
+	uint32_t start = 0U, len = 0U;
+	uint32_t best_start = 0U, best_len = 0U;
+
+	emmc_scc_enable();
+
+	tap_num = (GETR_32(SCC_DTCNTL) >> SCC_DTCNTL_TAPNUM_SHIFT) &
+		  SCC_DTCNTL_TAPNUM_MASK;
+	if ((tap_num == 0U) || (tap_num > SCC_TAP_MAX)) {
+		emmc_scc_disable();
+		return EMMC_ERR_STATE;
+	}
+
+	/* sweep all taps twice so that a window may wrap past tap 0 */
+	ntap = tap_num * 2U;
+
+	SETR_32(SD_SIZE, EMMC_TUNING_BLOCK_LENGTH);
+	mmc_drv_obj.tuning_flag = TRUE;
+	for (i = 0U; i < ntap; i++) {
+		SETR_32(SCC_TAPSET, (i % tap_num));
+		if ((emmc_send_tuning() == EMMC_SUCCESS)
+		    && (GETR_32(SCC_SMPCMP) == 0U)) {
+			good_taps |= (1U << i);
+		}
+	}
+	mmc_drv_obj.tuning_flag = FALSE;
+	SETR_32(SD_SIZE, EMMC_BLOCK_LENGTH);
+
+	/* longest run of good taps */
+	for (i = 0U; i < ntap; i++) {
+		if ((good_taps & (1U << i)) == 0U) {
+			len = 0U;
+			continue;
+		}
+		if (len == 0U) {
+			start = i;
+		}
+		len++;
+		if (len > best_len) {
+			best_start = start;
+			best_len = len;
+		}
+	}
+
+	VERBOSE("BL2: eMMC tuning taps=0x%x window=%u+%u\n",
+		good_taps, best_start, best_len);
+
+	if (best_len < EMMC_TUNING_MIN_WINDOW) {
+		emmc_scc_disable();
+		return EMMC_ERR_TRANSFER;
+	}
+
+	/* sample in the middle of the window, with auto correction on */
+	mmc_drv_obj.tuning_tap = (best_start + (best_len / 2U)) % tap_num;
+	SETR_32(SCC_TAPSET, mmc_drv_obj.tuning_tap);
+	SETR_32(SCC_RVSREQ, SCC_RVSREQ_CLEAR);
+	SETR_32(SCC_RVSCNTL, (GETR_32(SCC_RVSCNTL) | SCC_RVSCNTL_RVSEN));
+
+	return EMMC_SUCCESS;
+}
+
+static EMMC_ERROR_CODE emmc_select_hs200(void)
+{
+	EMMC_ERROR_CODE result;
+	uint8_t cardType;
+
+	/* HS200 needs 1.8V VCCQ, which is a property of the board */
+	cardType = (uint8_t) mmc_drv_obj.ext_csd_data[EMMC_EXT_CSD_CARD_TYPE];
+	if ((cardType & EMMC_EXT_CSD_CARD_TYPE_HS200_18V) == 0) {
+		return EMMC_ERR_ILLEGAL_CARD;
+	}
+
+	/* 8-bit SDR has already been selected by emmc_bus_width() */
+	result = emmc_switch(EMMC_SWITCH_HS_TIMING_HS200);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+	mmc_drv_obj.hs_timing = TIMING_HS200;
+
+	result = emmc_set_data_clock(MMC_200MHZ);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	result = emmc_execute_tuning();
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	return emmc_send_status();
+}
+
+#if PLAT_EMMC_BUS_MODE == EMMC_BUS_MODE_HS400
+static EMMC_ERROR_CODE emmc_select_hs400(void)
+{
+	EMMC_ERROR_CODE result;
+	uint8_t cardType;
+
+	cardType = (uint8_t) mmc_drv_obj.ext_csd_data[EMMC_EXT_CSD_CARD_TYPE];
+	if ((cardType & EMMC_EXT_CSD_CARD_TYPE_HS400_18V) == 0) {
+		return EMMC_ERR_ILLEGAL_CARD;
+	}
+
+	/*
+	 * HS400 is entered from High Speed timing at 52MHz or less; the
+	 * sampling tap found in HS200 is kept.
+	 */
+	SETR_32(SCC_RVSCNTL, (GETR_32(SCC_RVSCNTL) & ~SCC_RVSCNTL_RVSEN));
+	result = emmc_set_data_clock(MMC_52MHZ);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	result = emmc_switch(EMMC_SWITCH_HS_TIMING);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+	mmc_drv_obj.hs_timing = TIMING_HIGH_SPEED;
+
+	result = emmc_switch(EMMC_SWITCH_BUS_WIDTH_8DDR);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	result = emmc_switch(EMMC_SWITCH_HS_TIMING_HS400);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+	mmc_drv_obj.hs_timing = TIMING_HS400;
+
+	(void)emmc_clock_ctrl(FALSE);
+	SETR_32(SDIF_MODE, (GETR_32(SDIF_MODE) | SDIF_MODE_HS400));
+	SETR_32(SCC_DT2FF, SCC_DT2FF_TAPPOS);
+	SETR_32(SCC_TMPPORT2, (GETR_32(SCC_TMPPORT2) |
+			       SCC_TMPPORT2_HS400OSEL | SCC_TMPPORT2_HS400EN));
+	SETR_32(SCC_TAPSET, mmc_drv_obj.tuning_tap);
+	(void)emmc_clock_ctrl(TRUE);
+
+	result = emmc_set_data_clock(MMC_200MHZ);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+	SETR_32(SCC_RVSCNTL, (GETR_32(SCC_RVSCNTL) | SCC_RVSCNTL_RVSEN));
+
+	return emmc_send_status();
+}
+#endif /* PLAT_EMMC_BUS_MODE == EMMC_BUS_MODE_HS400 */
+
+static EMMC_ERROR_CODE emmc_fallback_hs52(void)
+{
+	EMMC_ERROR_CODE result;
+
+	emmc_scc_disable();
+
+	result = emmc_set_data_clock(MMC_52MHZ);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+
+	result = emmc_switch(EMMC_SWITCH_HS_TIMING);
+	if (result != EMMC_SUCCESS) {
+		return result;
+	}
+	mmc_drv_obj.hs_timing = TIMING_HIGH_SPEED;
+
+	/* back to 8-bit SDR in case HS400 got as far as DDR, reload EXT_CSD */
+	return emmc_set_ext_csd(EMMC_SWITCH_BUS_WIDTH_8);
+}
+#endif /* PLAT_EMMC_BUS_MODE != EMMC_BUS_MODE_HS52 */
+
+static void emmc_report_bus_mode(void)
+{
+	switch (mmc_drv_obj.hs_timing) {
+	case TIMING_HS400:
+		NOTICE("BL2: eMMC HS400 (tap %u)\n", mmc_drv_obj.tuning_tap);
+		break;
+	case TIMING_HS200:
+		NOTICE("BL2: eMMC HS200 (tap %u)\n", mmc_drv_obj.tuning_tap);
+		break;
+	case TIMING_HIGH_SPEED:
+		NOTICE("BL2: eMMC High Speed\n");
+		break;
+	default:
+		NOTICE("BL2: eMMC Backward Compatible\n");
+		break;
+	}
+}
+
 EMMC_ERROR_CODE emmc_select_partition(EMMC_PARTITION_ID id)
 {
 	EMMC_ERROR_CODE result;
@@ -658,8 +966,31 @@ EMMC_ERROR_CODE emmc_mount(void)
 		return result;
 	}
 
+#if PLAT_EMMC_BUS_MODE != EMMC_BUS_MODE_HS52
+	/* Switching HS200/HS400, HS52 is kept if the card or tuning fails */
+	result = emmc_select_hs200();
+#if PLAT_EMMC_BUS_MODE == EMMC_BUS_MODE_HS400
+	if (result == EMMC_SUCCESS) {
+		result = emmc_select_hs400();
+	}
+#endif
+	if (result != EMMC_SUCCESS) {
+		WARN("BL2: eMMC HS%u not available (%d)\n",
+		     (uint32_t)PLAT_EMMC_BUS_MODE, result);
+		result = emmc_fallback_hs52();
+		if (result != EMMC_SUCCESS) {
+			emmc_write_error_info_func_no(EMMC_FUNCNO_HIGH_SPEED);
+			if (emmc_clock_ctrl(FALSE) != EMMC_SUCCESS) {
+				/* nothing to do. */
+			}
+			return result;
+		}
+	}
+#endif
+
 	/* mount complete */
 	mmc_drv_obj.mount = TRUE;
+	emmc_report_bus_mode();
 
 	return EMMC_SUCCESS;
 }
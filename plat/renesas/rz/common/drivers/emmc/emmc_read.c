@@ -31,6 +31,21 @@ static EMMC_ERROR_CODE emmc_multiple_block_read(uint32_t *buff_address_virtual,
 		return EMMC_ERR_PARAM;
 	}
 
+	/* DM_DTRAN_ADDR only takes a 32-bit, 8-byte aligned address */
+	if ((transfer_mode == HAL_MEMCARD_DMA)
+	    && ((((uintptr_t) buff_address_virtual & ~DM_DTRAN_ADDR_WRITE_MASK) != 0)
+		|| (((uintptr_t) buff_address_virtual +
+		     ((size_t) count << EMMC_SECTOR_SIZE_SHIFT) - 1U) > UINT32_MAX))) {
+		emmc_write_error_info(EMMC_FUNCNO_READ_SECTOR, EMMC_ERR_PARAM);
+		return EMMC_ERR_PARAM;
+	}
+
+	if (transfer_mode == HAL_MEMCARD_DMA) {
+		/* drop dirty lines so that no eviction lands on the DMA data */
+		flush_dcache_range((uint64_t) buff_address_virtual,
+				   ((size_t) count << EMMC_SECTOR_SIZE_SHIFT));
+	}
+
 	/* CMD23 */
 	emmc_make_nontrans_cmd(CMD23_SET_BLOCK_COUNT, count);
 	result = emmc_exec_cmd(EMMC_R1_ERROR_MASK, mmc_drv_obj.response);
@@ -59,7 +74,11 @@ static EMMC_ERROR_CODE emmc_multiple_block_read(uint32_t *buff_address_virtual,
 		return result;
 	}
 
-	if (transfer_mode == HAL_MEMCARD_NOT_DMA) {
+	if (transfer_mode == HAL_MEMCARD_DMA) {
+		/* discard lines speculatively fetched during the transfer */
+		inv_dcache_range((uint64_t) buff_address_virtual,
+				 ((size_t) count << EMMC_SECTOR_SIZE_SHIFT));
+	} else {
 		flush_dcache_range((uint64_t) buff_address_virtual,
 				   ((size_t) count << EMMC_SECTOR_SIZE_SHIFT));
 	}
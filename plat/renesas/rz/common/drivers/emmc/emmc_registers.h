@@ -86,6 +86,7 @@
 #define SOFT_RST		(MMC_SD_BASE + 0x0380U)
 #define VERSION			(MMC_SD_BASE + 0x0388U)
 #define HOST_MODE		(MMC_SD_BASE + 0x0390U)
+#define SDIF_MODE		(MMC_SD_BASE + 0x0398U)
 #define DM_CM_DTRAN_MODE	(MMC_SD_BASE + 0x0820U)
 #define DM_CM_DTRAN_CTRL	(MMC_SD_BASE + 0x0828U)
 #define DM_CM_RST		(MMC_SD_BASE + 0x0830U)
@@ -95,6 +96,16 @@
 #define DM_CM_INFO2_MASK	(MMC_SD_BASE + 0x0858U)
 #define DM_DTRAN_ADDR		(MMC_SD_BASE + 0x0880U)
 
+/* Sampling clock controller (SCC) */
+#define SCC_DTCNTL		(MMC_SD_BASE + 0x1000U)
+#define SCC_TAPSET		(MMC_SD_BASE + 0x1008U)
+#define SCC_DT2FF		(MMC_SD_BASE + 0x1010U)
+#define SCC_CKSEL		(MMC_SD_BASE + 0x1018U)
+#define SCC_RVSCNTL		(MMC_SD_BASE + 0x1020U)
+#define SCC_RVSREQ		(MMC_SD_BASE + 0x1028U)
+#define SCC_SMPCMP		(MMC_SD_BASE + 0x1030U)
+#define SCC_TMPPORT2		(MMC_SD_BASE + 0x1038U)
+
 /* SD_INFO1 Registers */
 #define SD_INFO1_HPIRES		0x00010000UL /* Response Reception Completion */
 #define SD_INFO1_INFO10		0x00000400UL /* Indicates the SDDAT3 state */
@@ -169,6 +180,21 @@
 #define MMC_SD_CLK_DIV256	0x00000040UL	/* 1/256 */
 #define MMC_SD_CLK_DIV512	0x00000080UL	/* 1/512 */
 
+/* SDIF_MODE */
+#define SDIF_MODE_HS400			0x00000001UL	/* DDR transfer on CMD/DAT */
+
+/* SCC */
+#define SCC_DTCNTL_TAPEN		0x00000001UL
+#define SCC_DTCNTL_TAPNUM_SHIFT		16U
+#define SCC_DTCNTL_TAPNUM_MASK		0x000000FFUL
+#define SCC_CKSEL_DTSEL			0x00000001UL
+#define SCC_RVSCNTL_RVSEN		0x00000001UL
+#define SCC_RVSREQ_CLEAR		0x00000000UL
+#define SCC_TMPPORT2_HS400OSEL		0x00000010UL
+#define SCC_TMPPORT2_HS400EN		0x80000000UL
+#define SCC_DT2FF_TAPPOS		0x00000300UL	/* data to FF timing */
+#define SCC_TAP_MAX			16U
+
 /* DM_CM_DTRAN_MODE */
 #define DM_CM_DTRAN_MODE_CH0		0x00000000UL	/* CH0(downstream) */
 #define DM_CM_DTRAN_MODE_CH1		0x00010000UL	/* CH1(upstream)   */
@@ -238,6 +238,10 @@ typedef enum {
 #define EMMC_EXT_CSD_CARD_TYPE_DDR_52MHZ_12V		0x04
 #define EMMC_EXT_CSD_CARD_TYPE_DDR_52MHZ_18V		0x08
 #define EMMC_EXT_CSD_CARD_TYPE_52MHZ_MASK		0x0e
+#define EMMC_EXT_CSD_CARD_TYPE_HS200_18V		0x10
+#define EMMC_EXT_CSD_CARD_TYPE_HS200_12V		0x20
+#define EMMC_EXT_CSD_CARD_TYPE_HS400_18V		0x40
+#define EMMC_EXT_CSD_CARD_TYPE_HS400_12V		0x80
 
 /* SWITCH (CMD6) argument */
 #define EXTCSD_ACCESS_BYTE	(BIT25 | BIT24)
@@ -259,6 +263,10 @@ typedef enum {
 					 HS_TIMING_1)		/* H'03b90100 */
 #define EMMC_SWITCH_HS_TIMING_OFF	(EXTCSD_ACCESS_BYTE |\
 					 HS_TIMING_ADD)		/* H'03b90000 */
+#define EMMC_SWITCH_HS_TIMING_HS200	(EXTCSD_ACCESS_BYTE | HS_TIMING_ADD |\
+					 HS_TIMING_HS200)	/* H'03b90200 */
+#define EMMC_SWITCH_HS_TIMING_HS400	(EXTCSD_ACCESS_BYTE | HS_TIMING_ADD |\
+					 HS_TIMING_HS400)	/* H'03b90300 */
 
 #define EMMC_SWITCH_BUS_WIDTH_1		(EXTCSD_ACCESS_BYTE | BUS_WIDTH_ADD |\
 					 BUS_WIDTH_1)		/* H'03b70000 */
@@ -274,6 +282,18 @@ typedef enum {
 #define EMMC_SWITCH_PARTITION_CONFIG	0x03B30000UL
 
 #define TIMING_HIGH_SPEED		1UL
+#define TIMING_HS200			2UL
+#define TIMING_HS400			3UL
+
+/* Bus mode requested by PLAT_EMMC_BUS_MODE */
+#define EMMC_BUS_MODE_HS52		0U
+#define EMMC_BUS_MODE_HS200		200U
+#define EMMC_BUS_MODE_HS400		400U
+
+/* CMD21 tuning block (8-bit bus) */
+#define EMMC_TUNING_BLOCK_LENGTH	128U
+/* minimum number of consecutive good taps to accept a tuning result */
+#define EMMC_TUNING_MIN_WINDOW		3U
 #define EMMC_BOOT_PARTITION_EN_MASK	0x38U
 #define EMMC_BOOT_PARTITION_EN_SHIFT	3U
 
@@ -420,12 +440,16 @@ typedef struct {
 	volatile uint32_t state_machine_blocking;
 	/* True : get partition access processing */
 	volatile uint32_t get_partition_access_flag;
+	/* True : CMD21 tuning in progress, failures are expected */
+	volatile uint32_t tuning_flag;
 
 	EMMC_PARTITION_ID boot_partition_en;	/* Boot partition */
 	EMMC_PARTITION_ID partition_access;	/* Current access partition */
 
 	/* timeout */
 	uint32_t hs_timing;
+	/* SCC sampling clock tap selected by tuning */
+	uint32_t tuning_tap;
 
 	/* read and write data timeout */
 	uint32_t data_timeout;
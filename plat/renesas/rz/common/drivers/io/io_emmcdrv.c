@@ -8,6 +8,7 @@
 #include <assert.h>
 
 #include <common/debug.h>
+#include <platform_def.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_storage.h>
 
@@ -18,8 +19,14 @@
 #include "io_common.h"
 #include "io_emmcdrv.h"
 #include "io_private.h"
+#include "io_sector_cache.h"
 
-static uint8_t sector_buf[EMMC_SECTOR_SIZE] __attribute__((aligned(8)));
+/* DM_DTRAN_ADDR alignment required by the SDHI DMAC */
+#define EMMC_DMA_ALIGN		8U
+
+#if PLAT_EMMC_WRITE_ENABLE
+static uint8_t sector_buf[EMMC_SECTOR_SIZE] __attribute__((aligned(CACHE_WRITEBACK_GRANULE)));
+#endif
 
 static int32_t emmcdrv_dev_open(const uintptr_t spec __attribute__ ((unused)),
 				io_dev_info_t **dev_info);
@@ -52,69 +59,92 @@ static int32_t emmcdrv_block_seek(io_entity_t *entity, int32_t mode,
 	return IO_SUCCESS;
 }
 
+static uint32_t emmcdrv_dma_flags(uintptr_t buffer, size_t length)
+{
+#if PLAT_EMMC_DMA_ENABLE
+	/*
+	 * The SDHI DMAC takes a 32-bit, 8-byte aligned destination. Partial
+	 * cache lines at either end are safe because emmc_read_sector() cleans
+	 * them before the transfer and nothing touches them until it ends.
+	 */
+	if (((buffer & (EMMC_DMA_ALIGN - 1U)) == 0U) &&
+	    ((buffer + length - 1U) <= (uintptr_t)UINT32_MAX)) {
+		return LOADIMAGE_FLAGS_DMA_ENABLE;
+	}
+#endif
+	return 0U;
+}
+
+static int32_t emmcdrv_cache_fill(uintptr_t buffer, uint32_t sector,
+				  uint32_t count)
+{
+	if (emmc_read_sector((uint32_t *)buffer, sector, count,
+			emmcdrv_dma_flags(buffer, (size_t)count << EMMC_SECTOR_SIZE_SHIFT))
+			!= EMMC_SUCCESS) {
+		return IO_FAIL;
+	}
+
+	return IO_SUCCESS;
+}
+
 static int32_t emmcdrv_block_read(io_entity_t *entity, uintptr_t buffer,
 				  size_t length, size_t *length_read)
 {
 	file_state_t *fp = (file_state_t *) entity->info;
-	uint32_t first_sector, last_sector, sector_count, emmc_dma = 0;
-	size_t buffer_offset = 0;
+	unsigned long long pos = fp->base + fp->file_pos;
+	uint32_t dev_id = SECTOR_CACHE_DEV_EMMC | (uint32_t)fp->partition;
+	uint32_t first_sector, sector_count;
+	size_t head, middle, tail;
 	int32_t result = IO_SUCCESS;
 
-	first_sector = (fp->base + fp->file_pos) >> EMMC_SECTOR_SIZE_SHIFT;
-	last_sector = (fp->base + fp->file_pos + length - 1) >> EMMC_SECTOR_SIZE_SHIFT;
-	sector_count = last_sector - first_sector + 1;
-
-	INFO("Load dst=0x%lx src=(p:%d)0x%llx(%d) len=0x%lx(%d)\n",
+	INFO("Load dst=0x%lx src=(p:%d)0x%llx(%lld) len=0x%lx\n",
 			buffer,
-			fp->partition, (fp->base + fp->file_pos),
-			first_sector, length, sector_count);
+			fp->partition, pos,
+			pos >> EMMC_SECTOR_SIZE_SHIFT, length);
 
 	assert((fp->file_pos + length) <= fp->size);
 
-//	Temporarily disable DMA.
-//	if ((buffer + length - 1U) <= (uintptr_t)UINT32_MAX) {
-//		emmc_dma = LOADIMAGE_FLAGS_DMA_ENABLE;
-//	}
+	/*
+	 * Short reads and the partial sectors at either end go through the
+	 * sector cache, whole sectors in between straight to the buffer.
+	 */
+	if (length <= SECTOR_CACHE_LINE_SIZE) {
+		head = length;
+	} else {
+		head = (EMMC_SECTOR_SIZE - (pos % EMMC_SECTOR_SIZE)) % EMMC_SECTOR_SIZE;
+	}
+	tail = (pos + length) % EMMC_SECTOR_SIZE;
+	tail = ((length - head) < tail) ? (length - head) : tail;
+	middle = length - head - tail;
 
 	// first sector
-	uint32_t first_offset = (fp->base + fp->file_pos) % EMMC_SECTOR_SIZE;
-
-	if (first_offset > 0) {
-		memset(sector_buf, 0x00, EMMC_SECTOR_SIZE);
-		if (emmc_read_sector((uint32_t *)sector_buf,
-			first_sector, 1, emmc_dma) != EMMC_SUCCESS) {
+	if (head > 0) {
+		if (sector_cache_read(dev_id, emmcdrv_cache_fill, pos, buffer,
+				head) != 0) {
 			result = IO_FAIL;
 			goto block_read_done;
-		} else {
-			buffer_offset = EMMC_SECTOR_SIZE - first_offset;
-			buffer_offset = (length < buffer_offset) ? length : buffer_offset;
-
-			memcpy((uint8_t *)buffer, &sector_buf[first_offset], buffer_offset);
-
-			first_sector++;
-			sector_count--;
 		}
 	}
 
-	// last sector
-	uint32_t last_offset = (fp->base + fp->file_pos + length) % EMMC_SECTOR_SIZE;
-
-	if (0 < sector_count && 0 < last_offset) {
-		memset(sector_buf, 0x00, EMMC_SECTOR_SIZE);
-		if (emmc_read_sector((uint32_t *)sector_buf,
-				last_sector, 1, emmc_dma) != EMMC_SUCCESS) {
+	// middle sector
+	if (middle > 0) {
+		first_sector = (pos + head) >> EMMC_SECTOR_SIZE_SHIFT;
+		sector_count = middle >> EMMC_SECTOR_SIZE_SHIFT;
+
+		if (emmc_read_sector((uint32_t *)(buffer + head),
+				first_sector, sector_count,
+				emmcdrv_dma_flags(buffer + head,
+						  middle)) != EMMC_SUCCESS) {
 			result = IO_FAIL;
 			goto block_read_done;
-		} else {
-			memcpy((uint8_t *) buffer + (length - last_offset), &sector_buf[0], last_offset);
-			sector_count--;
 		}
 	}
 
-	// middle sector
-	if (sector_count > 0) {
-		if (emmc_read_sector((uint32_t *)(buffer + buffer_offset),
-				first_sector, sector_count, emmc_dma) != EMMC_SUCCESS) {
+	// last sector (read after the middle ones, see emmcdrv_dma_flags())
+	if (tail > 0) {
+		if (sector_cache_read(dev_id, emmcdrv_cache_fill,
+				pos + length - tail, buffer + length - tail,
+				tail) != 0) {
 			result = IO_FAIL;
 			goto block_read_done;
 		}
@@ -141,6 +171,8 @@ static int32_t emmcdrv_block_write(io_entity_t *entity, const uintptr_t buffer,
 
 	assert((fp->file_pos + length) <= fp->size);
 
+	sector_cache_invalidate();
+
 	// first sector
 	uint32_t first_offset = (fp->base + fp->file_pos) % EMMC_SECTOR_SIZE;
 
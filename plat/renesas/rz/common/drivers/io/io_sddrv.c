@@ -16,6 +16,7 @@
 
 #include "io_common.h"
 #include "io_sddrv.h"
+#include "io_sector_cache.h"
 
 #define DEV_SD0     (0)
 #define DEV_SD1     (1)
@@ -56,59 +57,63 @@ static int sddrv_block_seek(io_entity_t *entity, int32_t mode,
 	return 0;
 }
 
+static int32_t sddrv_cache_fill(uintptr_t buffer, uint32_t sector,
+				uint32_t count)
+{
+	if (sd_read_sect(sd_port, (uint8_t *)buffer, sector, count) != SD_OK)
+		return -EIO;
+
+	return 0;
+}
+
 static int sddrv_block_read(io_entity_t *entity, uintptr_t buffer,
 				  size_t length, size_t *length_read)
 {
 	file_state_t *fp = (file_state_t *) entity->info;
-	uint32_t first_sector, last_sector, sector_count = 0;
-	size_t buffer_offset = 0;
-
-	first_sector = (fp->base + fp->file_pos) / SD_SECTOR_SIZE;
-	last_sector = (fp->base + fp->file_pos + length - 1) / SD_SECTOR_SIZE;
-	sector_count = last_sector - first_sector + 1;
+	unsigned long long pos = fp->base + fp->file_pos;
+	uint32_t dev_id = SECTOR_CACHE_DEV_SD | (uint32_t)fp->partition;
+	size_t head, middle, tail;
 
-	INFO("Load dst=0x%lx src=(p:%d)0x%llx(%d) len=0x%lx(%d)\n",
+	INFO("Load dst=0x%lx src=(p:%d)0x%llx(%lld) len=0x%lx\n",
 			buffer,
-			fp->partition, (fp->base + fp->file_pos),
-			first_sector, length, sector_count);
+			fp->partition, pos,
+			pos / SD_SECTOR_SIZE, length);
 
 	assert((fp->file_pos + length) <= fp->size);
 
-	// first sector
-	uint32_t first_offset = (fp->base + fp->file_pos) % SD_SECTOR_SIZE;
-
-	if (first_offset > 0) {
-		memset(sd_rw_buff, 0x00, SD_SECTOR_SIZE);
+	/*
+	 * Short reads and the partial sectors at either end go through the
+	 * sector cache, whole sectors in between straight to the buffer.
+	 */
+	if (length <= SECTOR_CACHE_LINE_SIZE) {
+		head = length;
+	} else {
+		head = (SD_SECTOR_SIZE - (pos % SD_SECTOR_SIZE)) % SD_SECTOR_SIZE;
+	}
+	tail = (pos + length) % SD_SECTOR_SIZE;
+	tail = ((length - head) < tail) ? (length - head) : tail;
+	middle = length - head - tail;
 
-		if (sd_read_sect(sd_port, (uint8_t *)sd_rw_buff, first_sector, 1) != SD_OK)
+	// first sector
+	if (head > 0) {
+		if (sector_cache_read(dev_id, sddrv_cache_fill, pos, buffer,
+				head) != 0)
 			return -EIO;
-
-		buffer_offset = SD_SECTOR_SIZE - first_offset;
-		buffer_offset = (length < buffer_offset) ? length : buffer_offset;
-
-		memcpy((uint8_t *)buffer, &sd_rw_buff[first_offset], buffer_offset);
-
-		first_sector++;
-		sector_count--;
 	}
 
 	// last sector
-	uint32_t last_offset = (fp->base + fp->file_pos + length) % SD_SECTOR_SIZE;
-
-	if (0 < sector_count && 0 < last_offset) {
-		memset(sd_rw_buff, 0x00, SD_SECTOR_SIZE);
-
-		if (sd_read_sect(sd_port, (uint8_t *)sd_rw_buff, last_sector, 1) != SD_OK)
+	if (tail > 0) {
+		if (sector_cache_read(dev_id, sddrv_cache_fill,
+				pos + length - tail, buffer + length - tail,
+				tail) != 0)
 			return -EIO;
-
-		memcpy((uint8_t *) buffer + (length - last_offset), &sd_rw_buff[0], last_offset);
-		sector_count--;
 	}
 
 	// middle sector
-	if (sector_count > 0) {
-		if (sd_read_sect(sd_port, (uint8_t *)(buffer + buffer_offset),
-				first_sector, sector_count) != SD_OK) {
+	if (middle > 0) {
+		if (sd_read_sect(sd_port, (uint8_t *)(buffer + head),
+				(pos + head) / SD_SECTOR_SIZE,
+				middle / SD_SECTOR_SIZE) != SD_OK) {
 			return -EIO;
 		}
 	}
@@ -132,6 +137,8 @@ static int sddrv_block_write(io_entity_t *entity, const uintptr_t buffer,
 
 	assert((fp->file_pos + length) <= fp->size);
 
+	sector_cache_invalidate();
+
 	// first sector
 	uint32_t first_offset = (fp->base + fp->file_pos) % SD_SECTOR_SIZE;
 
@@ -245,10 +252,24 @@ static const io_dev_connector_t sddrv_dev_connector = {
 	&sddrv_dev_open,
 };
 
+static void sddrv_report_bus_mode(uint16_t speed)
+{
+	if ((speed & SD_CUR_SDR104) != 0U) {
+		NOTICE("BL2: SD SDR104\n");
+	} else if ((speed & SD_CUR_SDR50) != 0U) {
+		NOTICE("BL2: SD SDR50\n");
+	} else if ((speed & SD_CUR_HIGH_SPEED) != 0U) {
+		NOTICE("BL2: SD High Speed\n");
+	} else {
+		NOTICE("BL2: SD Default Speed\n");
+	}
+}
+
 static int sddrv_dev_open(const uintptr_t spec __attribute__ ((unused)),
 				io_dev_info_t **dev_info)
 {
 	uint16_t    type;
+	uint16_t    speed;
 
 	*dev_info = (io_dev_info_t *) &sddrv_dev_info;
 
@@ -275,7 +296,7 @@ static int sddrv_dev_open(const uintptr_t spec __attribute__ ((unused)),
 		panic();
 	}
 
-	if (sd_get_type(sd_port, &type, NULL, NULL) != SD_OK) {
+	if (sd_get_type(sd_port, &type, &speed, NULL) != SD_OK) {
 		ERROR("Failed to sd_get_type.\n");
 		panic();
 	}
@@ -287,6 +308,8 @@ static int sddrv_dev_open(const uintptr_t spec __attribute__ ((unused)),
 		panic();
 	}
 
+	sddrv_report_bus_mode(speed);
+
 	return 0;
 }
 
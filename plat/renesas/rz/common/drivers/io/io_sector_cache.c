@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <platform_def.h>
+
+#include "io_sector_cache.h"
+
+/*
+ * Sectors are cached in lines of PLAT_SECTOR_CACHE_READ_AHEAD sectors, so a
+ * miss also reads the sectors that follow it with the same card command.
+ * Lines start on a multiple of the line size and are evicted least recently
+ * used first.
+ */
+#if (PLAT_SECTOR_CACHE_ENTRIES < 1) || (PLAT_SECTOR_CACHE_READ_AHEAD < 1)
+#error "PLAT_SECTOR_CACHE_ENTRIES and PLAT_SECTOR_CACHE_READ_AHEAD must be at least 1"
+#endif
+
+typedef struct {
+	uint32_t dev_id;
+	uint32_t sector;	/* First sector held */
+	uint32_t count;		/* Sectors held, 0 if the line is empty */
+	uint32_t age;		/* Last use, for LRU replacement */
+} sector_cache_line_t;
+
+static sector_cache_line_t sector_cache_lines[PLAT_SECTOR_CACHE_ENTRIES];
+static uint8_t sector_cache_data[PLAT_SECTOR_CACHE_ENTRIES][SECTOR_CACHE_LINE_SIZE]
+	__attribute__((aligned(CACHE_WRITEBACK_GRANULE)));
+static uint32_t sector_cache_clock;
+
+/* Return the index of the line holding the sector, filling one if needed */
+static int32_t sector_cache_lookup(uint32_t dev_id, sector_cache_fill_t fill,
+				   uint32_t sector)
+{
+	sector_cache_line_t *line;
+	uint32_t victim = 0U;
+	uint32_t first;
+	uint32_t i;
+
+	for (i = 0U; i < PLAT_SECTOR_CACHE_ENTRIES; i++) {
+		line = &sector_cache_lines[i];
+		if ((line->count != 0U) && (line->dev_id == dev_id) &&
+		    (sector >= line->sector) &&
+		    (sector < (line->sector + line->count))) {
+			line->age = ++sector_cache_clock;
+			return (int32_t)i;
+		}
+
+		if ((line->count == 0U) ||
+		    ((sector_cache_lines[victim].count != 0U) &&
+		     (line->age < sector_cache_lines[victim].age))) {
+			victim = i;
+		}
+	}
+
+	line = &sector_cache_lines[victim];
+	line->count = 0U;
+
+	first = sector - (sector % PLAT_SECTOR_CACHE_READ_AHEAD);
+	if (fill((uintptr_t)sector_cache_data[victim], first,
+		 PLAT_SECTOR_CACHE_READ_AHEAD) == 0) {
+		line->sector = first;
+		line->count = PLAT_SECTOR_CACHE_READ_AHEAD;
+	} else if (fill((uintptr_t)sector_cache_data[victim], sector, 1U) == 0) {
+		/* The read-ahead may run past the end of the partition */
+		line->sector = sector;
+		line->count = 1U;
+	} else {
+		return -EIO;
+	}
+
+	line->dev_id = dev_id;
+	line->age = ++sector_cache_clock;
+
+	return (int32_t)victim;
+}
+
+/*
+ * Copy length bytes from byte offset pos of the device through the cache.
+ * Meant for partial sectors and short reads; bulk reads should go to the
+ * card directly.
+ */
+int32_t sector_cache_read(uint32_t dev_id, sector_cache_fill_t fill,
+			  unsigned long long pos, uintptr_t buffer,
+			  size_t length)
+{
+	const sector_cache_line_t *line;
+	uint32_t sector;
+	size_t offset;
+	size_t chunk;
+	int32_t index;
+
+	while (length != 0U) {
+		sector = (uint32_t)(pos / SECTOR_CACHE_SECTOR_SIZE);
+		index = sector_cache_lookup(dev_id, fill, sector);
+		if (index < 0) {
+			return index;
+		}
+
+		line = &sector_cache_lines[index];
+		offset = (size_t)(pos - ((unsigned long long)line->sector *
+					 SECTOR_CACHE_SECTOR_SIZE));
+		chunk = ((size_t)line->count * SECTOR_CACHE_SECTOR_SIZE) - offset;
+		chunk = (length < chunk) ? length : chunk;
+
+		memcpy((void *)buffer, &sector_cache_data[index][offset], chunk);
+
+		buffer += chunk;
+		pos += chunk;
+		length -= chunk;
+	}
+
+	return 0;
+}
+
+/* Drop all cached sectors, e.g. before writing to the card */
+void sector_cache_invalidate(void)
+{
+	memset(sector_cache_lines, 0, sizeof(sector_cache_lines));
+}
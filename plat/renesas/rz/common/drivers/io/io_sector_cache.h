@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IO_SECTOR_CACHE_H
+#define IO_SECTOR_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SECTOR_CACHE_SECTOR_SIZE	(512U)
+#define SECTOR_CACHE_LINE_SIZE		(PLAT_SECTOR_CACHE_READ_AHEAD * SECTOR_CACHE_SECTOR_SIZE)
+
+/* Cache keys, or'ed with the partition number */
+#define SECTOR_CACHE_DEV_EMMC		(0x100U)
+#define SECTOR_CACHE_DEV_SD			(0x200U)
+
+/* Reads count sectors starting at sector into buffer, returns 0 on success */
+typedef int32_t (*sector_cache_fill_t)(uintptr_t buffer, uint32_t sector,
+				       uint32_t count);
+
+int32_t sector_cache_read(uint32_t dev_id, sector_cache_fill_t fill,
+			  unsigned long long pos, uintptr_t buffer,
+			  size_t length);
+void sector_cache_invalidate(void);
+
+#endif /* IO_SECTOR_CACHE_H */
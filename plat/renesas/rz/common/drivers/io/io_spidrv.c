@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2014-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <platform_def.h>
+
+#include <common/debug.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_storage.h>
+#include <lib/utils.h>
+#include <dmac.h>
+#include "io_spidrv.h"
+
+/* Reads shorter than this are not worth programming the DMAC for */
+#define SPIDRV_DMA_MIN_LEN		(0x1000U)
+
+/* As we need to be able to keep state for seek, only one file can be open
+ * at a time. Make this a structure and point to the entity->info. When we
+ * can malloc memory we can change this to support more open files.
+ */
+typedef struct {
+	/* Use the 'in_use' flag as any value for base and file_pos could be
+	 * valid.
+	 */
+	int			in_use;
+	uintptr_t		base;
+	unsigned long long	file_pos;
+	unsigned long long	size;
+} spidrv_file_state_t;
+
+static spidrv_file_state_t current_spidrv_file = {0};
+
+/* The DMAC copy of the aligned middle of a read, with CPU copied ends */
+typedef struct {
+	bool			busy;
+	unsigned int		tag;
+	uintptr_t		dst;
+	uintptr_t		src;
+	size_t			length;
+	size_t			head;
+	size_t			body;
+} spidrv_dma_state_t;
+
+static spidrv_dma_state_t spidrv_dma;
+
+/* Set while the next DMA read may be left running after the read returns */
+static bool spidrv_async_armed;
+static unsigned int spidrv_async_tag;
+
+/* Identify the device type as memmap */
+static io_type_t device_type_spidrv(void)
+{
+	return IO_TYPE_MEMMAP;
+}
+
+/* SPI ROM window device functions */
+static int spidrv_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
+static int spidrv_block_open(io_dev_info_t *dev_info, const uintptr_t spec,
+			     io_entity_t *entity);
+static int spidrv_block_seek(io_entity_t *entity, int mode,
+			     signed long long offset);
+static int spidrv_block_len(io_entity_t *entity, size_t *length);
+static int spidrv_block_read(io_entity_t *entity, uintptr_t buffer,
+			     size_t length, size_t *length_read);
+static int spidrv_block_close(io_entity_t *entity);
+static int spidrv_dev_close(io_dev_info_t *dev_info);
+
+
+static const io_dev_connector_t spidrv_dev_connector = {
+	.dev_open = spidrv_dev_open
+};
+
+
+static const io_dev_funcs_t spidrv_dev_funcs = {
+	.type = device_type_spidrv,
+	.open = spidrv_block_open,
+	.seek = spidrv_block_seek,
+	.size = spidrv_block_len,
+	.read = spidrv_block_read,
+	.write = NULL,
+	.close = spidrv_block_close,
+	.dev_init = NULL,
+	.dev_close = spidrv_dev_close,
+};
+
+
+/* No state associated with this device so structure can be const */
+static io_dev_info_t spidrv_dev_info = {
+	.funcs = &spidrv_dev_funcs,
+	.info = (uintptr_t)NULL
+};
+
+
+/* Open a connection to the SPI ROM window device */
+static int spidrv_dev_open(const uintptr_t dev_spec __unused,
+			   io_dev_info_t **dev_info)
+{
+	assert(dev_info != NULL);
+	*dev_info = &spidrv_dev_info;
+	/* A channel that does not reset is retried by each DMA read */
+	(void)dmac_init();
+	return 0;
+}
+
+
+/* Close a connection to the SPI ROM window device */
+static int spidrv_dev_close(io_dev_info_t *dev_info)
+{
+	/* NOP */
+	return 0;
+}
+
+
+/* Open a file on the SPI ROM window device */
+static int spidrv_block_open(io_dev_info_t *dev_info, const uintptr_t spec,
+			     io_entity_t *entity)
+{
+	int result = -ENOMEM;
+	const io_block_spec_t *block_spec = (io_block_spec_t *)spec;
+
+	/* Since we need to track open state for seek() we only allow one open
+	 * spec at a time. When we have dynamic memory we can malloc and set
+	 * entity->info.
+	 */
+	if (current_spidrv_file.in_use == 0) {
+		assert(block_spec != NULL);
+		assert(entity != NULL);
+
+		current_spidrv_file.in_use = 1;
+		current_spidrv_file.base = block_spec->offset;
+		/* File cursor offset for seek and incremental reads etc. */
+		current_spidrv_file.file_pos = 0;
+		current_spidrv_file.size = block_spec->length;
+		entity->info = (uintptr_t)&current_spidrv_file;
+		result = 0;
+	} else {
+		WARN("A SPI ROM device is already active. Close first.\n");
+	}
+
+	return result;
+}
+
+
+/* Seek to a particular file offset on the SPI ROM window device */
+static int spidrv_block_seek(io_entity_t *entity, int mode,
+			     signed long long offset)
+{
+	int result = -ENOENT;
+	spidrv_file_state_t *fp;
+
+	/* We only support IO_SEEK_SET for the moment. */
+	if (mode == IO_SEEK_SET) {
+		assert(entity != NULL);
+
+		fp = (spidrv_file_state_t *) entity->info;
+
+		/* Assert that new file position is valid */
+		assert((offset >= 0) &&
+			   ((unsigned long long)offset < fp->size));
+
+		/* Reset file position */
+		fp->file_pos = (unsigned long long)offset;
+		result = 0;
+	}
+
+	return result;
+}
+
+
+/* Return the size of a file on the SPI ROM window device */
+static int spidrv_block_len(io_entity_t *entity, size_t *length)
+{
+	assert(entity != NULL);
+	assert(length != NULL);
+
+	*length = (size_t)((spidrv_file_state_t *)entity->info)->size;
+
+	return 0;
+}
+
+
+/*
+ * Start the DMAC on the cache line aligned middle of a read. Returns false,
+ * with nothing copied, if the DMAC could not be used for this read; the
+ * caller then copies the whole range with the CPU.
+ */
+static bool spidrv_dma_start(uintptr_t dst, uintptr_t src, size_t length)
+{
+	size_t head;
+	size_t body;
+
+	if ((length < SPIDRV_DMA_MIN_LEN) ||
+	    (((dst ^ src) & (DMAC_ALIGN - 1U)) != 0U)) {
+		return false;
+	}
+
+	head = round_up(dst, CACHE_WRITEBACK_GRANULE) - dst;
+	body = round_down(length - head, CACHE_WRITEBACK_GRANULE);
+
+	/* Drop dirty lines so that no eviction lands on the DMA data */
+	flush_dcache_range(dst + head, body);
+
+	if (dmac_copy_start(dst + head, src + head, body) != DMAC_SUCCESS) {
+		return false;
+	}
+
+	spidrv_dma.busy = true;
+	spidrv_dma.dst = dst;
+	spidrv_dma.src = src;
+	spidrv_dma.length = length;
+	spidrv_dma.head = head;
+	spidrv_dma.body = body;
+
+	return true;
+}
+
+
+/*
+ * Wait for the DMAC read in flight, if any, and copy its ends. A read the
+ * DMAC fails is copied again by the CPU; the next one still tries the DMAC.
+ */
+static void spidrv_dma_complete(void)
+{
+	uintptr_t dst = spidrv_dma.dst;
+	uintptr_t src = spidrv_dma.src;
+	size_t head = spidrv_dma.head;
+	size_t body = spidrv_dma.body;
+
+	if (!spidrv_dma.busy) {
+		return;
+	}
+	spidrv_dma.busy = false;
+
+	if (dmac_copy_wait() != DMAC_SUCCESS) {
+		memcpy((void *)dst, (void *)src, spidrv_dma.length);
+		return;
+	}
+
+	/* Discard lines speculatively fetched during the transfer */
+	inv_dcache_range(dst + head, body);
+
+	memcpy((void *)dst, (void *)src, head);
+	memcpy((void *)(dst + head + body), (void *)(src + head + body),
+	       spidrv_dma.length - head - body);
+}
+
+
+/* Read data from a file on the SPI ROM window device */
+static int spidrv_block_read(io_entity_t *entity, uintptr_t buffer,
+			     size_t length, size_t *length_read)
+{
+	spidrv_file_state_t *fp;
+	unsigned long long pos_after;
+	uintptr_t src;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+
+	fp = (spidrv_file_state_t *) entity->info;
+
+	/* Assert that file position is valid for this read operation */
+	pos_after = fp->file_pos + length;
+	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
+
+	/* The DMAC channel runs one read at a time */
+	spidrv_dma_complete();
+
+	src = (uintptr_t)(fp->base + fp->file_pos);
+	if (!spidrv_dma_start(buffer, src, length)) {
+		memcpy((void *)buffer, (void *)src, length);
+	} else if (spidrv_async_armed) {
+		/* Left running until spidrv_wait_async_read() or the next read */
+		spidrv_dma.tag = spidrv_async_tag;
+		spidrv_async_armed = false;
+	} else {
+		spidrv_dma_complete();
+	}
+
+	*length_read = length;
+
+	/* Set file position after read */
+	fp->file_pos = pos_after;
+
+	return 0;
+}
+
+
+/* Close a file on the SPI ROM window device */
+static int spidrv_block_close(io_entity_t *entity)
+{
+	assert(entity != NULL);
+
+	entity->info = 0;
+
+	/* This would be a mem free() if we had malloc.*/
+	zeromem((void *)&current_spidrv_file, sizeof(current_spidrv_file));
+
+	return 0;
+}
+
+
+/* Exported functions */
+
+/*
+ * Let the next read large enough for the DMAC return as soon as the transfer
+ * is started. The read is tagged so that spidrv_wait_async_read() can tell it
+ * apart from later ones.
+ */
+void spidrv_arm_async_read(unsigned int tag)
+{
+	spidrv_async_armed = true;
+	spidrv_async_tag = tag;
+}
+
+/* Wait for the read armed with this tag to land in memory */
+void spidrv_wait_async_read(unsigned int tag)
+{
+	if (spidrv_async_armed && (spidrv_async_tag == tag)) {
+		spidrv_async_armed = false;
+	}
+
+	if (spidrv_dma.busy && (spidrv_dma.tag == tag)) {
+		spidrv_dma_complete();
+	}
+}
+
+/* Register the SPI ROM window driver with the IO abstraction */
+int register_io_dev_spidrv(const io_dev_connector_t **dev_con)
+{
+	int result;
+
+	assert(dev_con != NULL);
+
+	result = io_register_device(&spidrv_dev_info);
+	if (result == 0)
+		*dev_con = &spidrv_dev_connector;
+
+	return result;
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IO_SPIDRV_H
+#define IO_SPIDRV_H
+
+struct io_dev_connector;
+
+int register_io_dev_spidrv(const struct io_dev_connector **dev_con);
+void spidrv_arm_async_read(unsigned int tag);
+void spidrv_wait_async_read(unsigned int tag);
+
+#endif /* IO_SPIDRV_H */
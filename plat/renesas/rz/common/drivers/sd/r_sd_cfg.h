@@ -67,7 +67,15 @@ Macro definitions
 		#define SD_CFG_DRIVER_MODE_CARD_TYPE    (SD_MODE_MEM)
 
 		/* the speed to support */
+#if   (PLAT_SD_BUS_MODE == 104)
+		#define SD_CFG_DRIVER_MODE_SPEED        (SD_MODE_HS | SD_MODE_SDR50 | SD_MODE_SDR104)
+#elif (PLAT_SD_BUS_MODE == 50)
+		#define SD_CFG_DRIVER_MODE_SPEED        (SD_MODE_HS | SD_MODE_SDR50)
+#elif (PLAT_SD_BUS_MODE == 1)
+		#define SD_CFG_DRIVER_MODE_SPEED        (SD_MODE_HS)
+#else
 		#define SD_CFG_DRIVER_MODE_SPEED        (SD_MODE_DS)
+#endif
 
 #if    defined(SD_CFG_VER2X)
 		/* the version to support */
@@ -85,6 +93,15 @@ Macro definitions
 																						SD_CFG_DRIVER_MODE_SPEED      | \
 																						SD_CFG_DRIVER_MODE_VER)
 
+/* ------------------------------------------------------
+	Set the SD clock plan (SDHI IMCLK = 133.25MHz)
+	The UHS-I rates are upper limits, the card is tuned
+	(CMD19) at whatever frequency is selected here.
+--------------------------------------------------------*/
+#define SD_CFG_CLK_DIV_HS                   (SD_DIV_4)      /* 133.25MHz/4 = 33.31MHz  (HS     <= 50MHz)  */
+#define SD_CFG_CLK_DIV_SDR50                (SD_DIV_2)      /* 133.25MHz/2 = 66.63MHz  (SDR50  <= 100MHz) */
+#define SD_CFG_CLK_DIV_SDR104               (SD_DIV_1)      /* 133.25MHz/1 = 133.25MHz (SDR104 <= 208MHz) */
+
 /* ==== end of the setting ==== */
 
 
@@ -179,6 +179,8 @@ Macro definitions
 #define SD_CLK_20MHZ              (0x0004u)             /* 20MHz */
 #define SD_CLK_25MHZ              (0x0005u)             /* 25MHz */
 #define SD_CLK_50MHZ              (0x0006u)             /* 50MHz (phys spec ver1.10) */
+#define SD_CLK_100MHZ             (0x0007u)             /* 100MHz (SDR50, phys spec ver3.01) */
+#define SD_CLK_208MHZ             (0x0008u)             /* 208MHz (SDR104, phys spec ver3.01) */
 
 /* ---- speed class ---- */
 #define SD_SPEED_CLASS_0          (0x00u)               /* not defined, or less than ver2.0 */
@@ -834,6 +836,8 @@ int32_t sddev_write_data(int32_t sd_port, uint8_t *buff, uint32_t reg_addr, int3
  * @warning       .
  * @param [in]    int32_t sd_port : channel no (0 or 1)
  * @param [in]    int32_t clock   : request clock frequency <br>
+ *                  SD_CLK_208MHZ <br>
+ *                  SD_CLK_100MHZ <br>
  *                  SD_CLK_50MHZ <br>
  *                  SD_CLK_25MHZ <br>
  *                  SD_CLK_20MHZ <br>
@@ -842,6 +846,8 @@ int32_t sddev_write_data(int32_t sd_port, uint8_t *buff, uint32_t reg_addr, int3
  *                  SD_CLK_1MHZ <br>
  *                  SD_CLK_400KHZ
  * @retval        clock div value <br>
+ *                  SD_DIV_1   : 1/1   clock <br>
+ *                  SD_DIV_2   : 1/2   clock <br>
  *                  SD_DIV_4   : 1/4   clock <br>
  *                  SD_DIV_8   : 1/8   clock <br>
  *                  SD_DIV_16  : 1/16  clock <br>
@@ -864,6 +870,19 @@ uint32_t sddev_get_clockdiv(int32_t sd_port, int32_t clock);
  *****************************************************************************/
 int32_t sddev_set_port(int32_t sd_port, int32_t mode);
 
+/* Function Name: sddev_set_voltage */
+/**************************************************************************//**
+ * @fn            int32_t sddev_set_voltage(int32_t sd_port, uint32_t voltage)
+ * @brief         switch SD bus signalling voltage
+ * @warning       only the SD IO pins are switched, VDD stays at 3.3V
+ * @param [in]    int32_t sd_port  : channel no (0 or 1)
+ * @param [in]    uint32_t voltage : SD_VOLT_3_3 : 3.3V signalling <br>
+ *                                 : SD_VOLT_1_8 : 1.8V signalling
+ * @retval        success : SD_OK
+ * @retval        fail    : SD_ERR
+ *****************************************************************************/
+int32_t sddev_set_voltage(int32_t sd_port, uint32_t voltage);
+
 /* Function Name: sddev_int_wait */
 /**************************************************************************//**
  * @fn            int32_t sddev_int_wait(int32_t sd_port, int32_t time)
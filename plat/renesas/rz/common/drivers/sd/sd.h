@@ -90,6 +90,10 @@ Macro definitions
 /* ---- dual voltage inquiry command (phys spec ver2.0) ---- */
 #define CMD8                        (0x0408u)                   /* SEND_IF_COND */
 
+/* ---- UHS-I commands (phys spec ver3.01) ---- */
+#define CMD11                       (0x040Bu)                   /* VOLTAGE_SWITCH */
+#define CMD19                       (0x1C13u)                   /* SEND_TUNING_BLOCK */
+
 /* ---- application specific commands ---- */
 #define ACMD6                       (0x40u|6u)                  /* SET_BUS_WIDTH */
 #define ACMD13                      (0x40u|13u)                 /* SD_STATUS */
@@ -214,6 +218,7 @@ Macro definitions
 #define SD_INFO2_MASK_SCLKDIVEN     ((uint64_t)(0x2000))        /* b13 : SD Bus Busy                            */
 #define SD_INFO2_MASK_WE            ((uint64_t)(0x0200))        /* b9  : SD_BUF Write Enable                    */
 #define SD_INFO2_MASK_RE            ((uint64_t)(0x0100))        /* b8  : SD_BUF Read Enable                     */
+#define SD_INFO2_MASK_DAT0          ((uint64_t)(0x0080))        /* b7  : SD_D0 State                            */
 #define SD_INFO2_MASK_ERR6          ((uint64_t)(0x0040))        /* b6  : Response Timeout                       */
 #define SD_INFO2_MASK_ERR5          ((uint64_t)(0x0020))        /* b5  : SD_BUF Illegal Read Access             */
 #define SD_INFO2_MASK_ERR4          ((uint64_t)(0x0010))        /* b4  : SD_BUF Illegal Write Access            */
@@ -308,6 +313,37 @@ Macro definitions
 #define SD_SUP_DEFAULT_SPEED        (0x0000u)                   /*   supported default speed mode   */
 #define SD_CUR_HIGH_SPEED           (0x0001u)                   /*   current high speed mode        */
 #define SD_SUP_HIGH_SPEED           (0x0100u)                   /*   supported high speed mode      */
+#define SD_CUR_SDR50                (0x0002u)                   /*   current SDR50 mode             */
+#define SD_SUP_SDR50                (0x0200u)                   /*   supported SDR50 mode           */
+#define SD_CUR_SDR104               (0x0004u)                   /*   current SDR104 mode            */
+#define SD_SUP_SDR104               (0x0400u)                   /*   supported SDR104 mode          */
+
+/* --- switch function (CMD6) ---- */
+#define SD_SWITCH_FUNC_BYTE         (64)                        /* switch function status size */
+#define SD_SWITCH_MODE_CHECK        (0x00FFu)                   /* arg[31:16] : check, other groups unchanged  */
+#define SD_SWITCH_MODE_SET          (0x80FFu)                   /* arg[31:16] : switch, other groups unchanged */
+#define SD_SWITCH_GRP1_KEEP         (0xFFF0u)                   /* arg[15:0]  : group 2-4 unchanged            */
+#define SD_SWITCH_GRP1_SUPPORT      (13)                        /* status[407:400] : group 1 support bits      */
+#define SD_SWITCH_GRP1_RESULT       (16)                        /* status[379:376] : group 1 selected function */
+#define SD_SWITCH_FUNC_HS           (1u)                        /* group 1 function 1 : HS / SDR25             */
+#define SD_SWITCH_FUNC_SDR50        (2u)                        /* group 1 function 2 : SDR50                  */
+#define SD_SWITCH_FUNC_SDR104       (3u)                        /* group 1 function 3 : SDR104                 */
+
+/* --- 1.8V signalling (phys spec ver3.01) ---- */
+#define SD_OCR_S18R                 (0x0100u)                   /* OCR[24] : switching to 1.8V request / accepted */
+#define SD_SIG_VOLT_3_3             (0u)                        /* 3.3V signalling */
+#define SD_SIG_VOLT_1_8             (1u)                        /* 1.8V signalling */
+
+/* --- sampling clock tuning (CMD19) ---- */
+#define SD_TUNING_BLOCK_BYTE        (64)                        /* tuning block size (4bits bus) */
+#define SD_TUNING_MIN_WINDOW        (3u)                        /* minimum number of good taps   */
+#define SD_SCC_DTCNTL_TAPEN         (0x00000001uL)              /* SCC_DTCNTL  b0     : TAPEN    */
+#define SD_SCC_DTCNTL_TAPNUM_SHIFT  (16)                        /* SCC_DTCNTL  b23-16 : TAPNUM   */
+#define SD_SCC_DTCNTL_TAPNUM_MASK   (0xFFuL)
+#define SD_SCC_CKSEL_DTSEL          (0x00000001uL)              /* SCC_CKSEL   b0     : DTSEL    */
+#define SD_SCC_RVSCNTL_RVSEN        (0x00000001uL)              /* SCC_RVSCNTL b0     : RVSEN    */
+#define SD_SCC_DT2FF_TAPPOS         (0x00000300uL)              /* SCC_DT2FF tap position        */
+#define SD_SCC_TAP_MAX              (16u)
 /* ==== format parameter ==== */
 #define SIZE_CARD_256KB             (256*1024/512)              /*  256*1KB/(sector size) */
 #define SIZE_CARD_1MB               (1024*1024/512)             /* 1024*1KB/(sector size) */
@@ -487,6 +523,8 @@ typedef struct __sdhndl                 /* SD handle */
 	uint32_t    buff_size;                              /* work buffer size */
 	int32_t     sup_if_mode;                            /* supported bus width (1bit:0 4bits:1) */
 	int32_t     partition_id;                           /* Partition ID for eSD */
+	uint8_t     sig_volt;                               /* signalling voltage (3.3V:0 1.8V:1) */
+	uint8_t     tuning_tap;                             /* SCC sampling tap (SDR50 and SDR104) */
 } st_sdhndl_t;
 
 extern st_sdhndl_t *gp_sdhandle[NUM_PORT];
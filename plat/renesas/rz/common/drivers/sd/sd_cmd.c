@@ -415,6 +415,7 @@ int32_t _sd_card_send_ocr(st_sdhndl_t *p_hndl, int32_t type)
 	int32_t ret;
 	int32_t i;
 	int32_t j = 0;
+	uint16_t s18r = 0;
 
 	/* ===== distinguish card type issuing CMD5, ACMD41 or CMD1 ==== */
 	for (i = 0; i < 200; i++) {
@@ -438,11 +439,16 @@ int32_t _sd_card_send_ocr(st_sdhndl_t *p_hndl, int32_t type)
 					/* cmd8 have response   *//* set HCS bit */
 					p_hndl->voltage |= 0x40000000;
 
+					/* request 1.8V signalling for UHS-I */
+					if (p_hndl->sup_speed & (SD_MODE_SDR50 | SD_MODE_SDR104)) {
+						s18r = SD_OCR_S18R;
+					}
 				}
 			}
 
 			/* ---- issue ACMD41 ---- *//* Cast to an appropriate type */
-			ret = _sd_send_acmd(p_hndl, ACMD41, (uint16_t)(p_hndl->voltage >> 16), (uint16_t)p_hndl->voltage);
+			ret = _sd_send_acmd(p_hndl, ACMD41, (uint16_t)((p_hndl->voltage >> 16) | s18r),
+								(uint16_t)p_hndl->voltage);
 			break;
 
 		case SD_MEDIA_MMC:  /* MMC */
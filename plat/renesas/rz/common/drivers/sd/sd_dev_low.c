@@ -16,6 +16,8 @@ Includes   <System Includes> , "Project Includes"
 ******************************************************************************/
 #include <stdint.h>
 #include <drivers/delay_timer.h>
+#include <lib/mmio.h>
+#include <pfc_regs.h>
 #include "sdmmc_iodefine.h"
 #include "r_sdif.h"
 #include "r_sd_cfg.h"
@@ -244,6 +246,8 @@ int32_t sddev_write_data(int32_t sd_port, uint8_t *buff, uint32_t reg_addr, int3
 * Description  : Get clock div value.
 * Arguments    : int32_t sd_port : channel no (0 or 1)
 *              : int32_t clock   : request clock frequency
+*              :   SD_CLK_208MHZ
+*              :   SD_CLK_100MHZ
 *              :   SD_CLK_50MHZ
 *              :   SD_CLK_25MHZ
 *              :   SD_CLK_20MHZ
@@ -252,6 +256,8 @@ int32_t sddev_write_data(int32_t sd_port, uint8_t *buff, uint32_t reg_addr, int3
 *              :   SD_CLK_1MHZ
 *              :   SD_CLK_400KHZ
 * Return Value : clock div value
+*              :   SD_DIV_1   : 1/1   clock
+*              :   SD_DIV_2   : 1/2   clock
 *              :   SD_DIV_4   : 1/4   clock
 *              :   SD_DIV_8   : 1/8   clock
 *              :   SD_DIV_16  : 1/16  clock
@@ -264,8 +270,14 @@ uint32_t sddev_get_clockdiv(int32_t sd_port, int32_t clock)
 	uint32_t div;
 
 	switch (clock) {
+	case SD_CLK_208MHZ:
+		div = SD_CFG_CLK_DIV_SDR104;
+		break;
+	case SD_CLK_100MHZ:
+		div = SD_CFG_CLK_DIV_SDR50;
+		break;
 	case SD_CLK_50MHZ:
-		div = SD_DIV_4;        /* 133.25MHz/4 = 33.31MHz   */
+		div = SD_CFG_CLK_DIV_HS;
 		break;
 	case SD_CLK_25MHZ:
 	case SD_CLK_20MHZ:
@@ -311,6 +323,46 @@ int32_t sddev_set_port(int32_t sd_port, int32_t mode)
  End of function sddev_set_port
  ******************************************************************************/
 
+/******************************************************************************
+* Function Name: sddev_set_voltage
+* Description  : switch SD bus signalling voltage
+* Arguments    : int32_t sd_port  : channel no (0 or 1)
+*              : uint32_t voltage : SD_VOLT_3_3 : 3.3V signalling
+*              :                  : SD_VOLT_1_8 : 1.8V signalling
+* Return Value : success : SD_OK
+*              : fail    : SD_ERR
+* Remark       : only the SoC side IO power of the SD pins is switched here,
+*              : boards that feed VCCQ from a switchable regulator must
+*              : extend this function
+******************************************************************************/
+int32_t sddev_set_voltage(int32_t sd_port, uint32_t voltage)
+{
+#if defined(PFC_SD_ch0)
+	uintptr_t reg;
+	uint32_t  poc;
+
+	reg = (0 == sd_port) ? PFC_SD_ch0 : PFC_SD_ch1;
+
+	if (SD_VOLT_1_8 == voltage) {
+		poc = 1;    /* 1.8V */
+	} else if (SD_VOLT_3_3 == voltage) {
+		poc = 0;    /* 3.3V */
+	} else {
+		return SD_ERR;
+	}
+
+	mmio_write_32(reg, poc);
+
+	return SD_OK;
+#else
+	/* IO voltage is fixed by the board */
+	return (SD_VOLT_3_3 == voltage) ? SD_OK : SD_ERR;
+#endif
+}
+/*******************************************************************************
+ End of function sddev_set_voltage
+ ******************************************************************************/
+
 /******************************************************************************
 * Function Name: sddev_int_wait
 * Description  : Waitting for SDHI Interrupt
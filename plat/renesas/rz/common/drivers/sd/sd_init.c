@@ -334,6 +334,8 @@ int32_t _sd_init_hndl(st_sdhndl_t *p_hndl, uint32_t mode, uint32_t voltage)
 	p_hndl->prot_sector_size = 0;
 	p_hndl->voltage = voltage;
 	p_hndl->speed_mode = 0;
+	p_hndl->sig_volt = SD_SIG_VOLT_3_3;
+	p_hndl->tuning_tap = 0;
 
 	/* Cast to an appropriate type */
 	p_hndl->int_mode = (uint8_t)(mode & 0x1u);
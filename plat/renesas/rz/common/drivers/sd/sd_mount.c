@@ -14,6 +14,7 @@
 Includes   <System Includes> , "Project Includes"
 ******************************************************************************/
 #include <stdint.h>
+#include <drivers/delay_timer.h>
 #include "r_sdif.h"
 #include "sd.h"
 #include "sdmmc_iodefine.h"
@@ -47,6 +48,14 @@ static int32_t _sd_write_byte_error(st_sdhndl_t *p_hndl);
 static int32_t _esd_card_query_partitions(st_sdhndl_t *p_hndl, uint32_t opcode, uint8_t *p_rw_buff);
 static int32_t _esd_card_select_partition(st_sdhndl_t *p_hndl, uint32_t id);
 static int32_t _esd_get_partition_id(st_sdhndl_t *p_hndl, int32_t *id);
+static int32_t _sd_card_reinit(st_sdhndl_t *p_hndl);
+static int32_t _sd_card_switch_volt(st_sdhndl_t *p_hndl);
+static int32_t _sd_card_switch_volt_error(st_sdhndl_t *p_hndl);
+static int32_t _sd_card_switch_speed(st_sdhndl_t *p_hndl);
+static int32_t _sd_card_set_func(st_sdhndl_t *p_hndl, uint32_t func);
+static int32_t _sd_card_set_uhs(st_sdhndl_t *p_hndl, uint32_t func, int32_t clock);
+static int32_t _sd_card_tuning(st_sdhndl_t *p_hndl, int32_t clock);
+static void    _sd_scc_disable(st_sdhndl_t *p_hndl);
 
 /******************************************************************************
  * Function Name: sd_mount
@@ -81,6 +90,7 @@ int32_t sd_mount(int32_t sd_port, uint32_t mode, uint32_t voltage)
 	uint64_t    info1_back;
 	uint16_t    sd_spec;
 	uint16_t    sd_spec3;
+	uint16_t    sup_speed;
 
 	if ((0 != sd_port) && (1 != sd_port)) {
 		return SD_ERR;
@@ -142,9 +152,21 @@ int32_t sd_mount(int32_t sd_port, uint32_t mode, uint32_t voltage)
 
 	sddev_unl_cpu(sd_port);
 
+	/* ---- sampling clock may still be tuned from a previous mount ---- */
+	if (p_hndl->sup_speed & (SD_MODE_SDR50 | SD_MODE_SDR104)) {
+		_sd_scc_disable(p_hndl);
+		if (_sd_set_clock(p_hndl, SD_CLK_400KHZ, SD_CLOCK_ENABLE) != SD_OK) {
+			return p_hndl->error;
+		}
+	}
+
 	/* ==== initialize card and distinguish card type ==== */
+	sup_speed = p_hndl->sup_speed;
 	if (_sd_card_init(p_hndl) != SD_OK) {
-		return _sd_mount_error(p_hndl);  /* failed card initialize */
+		/* a failed 1.8V switch drops UHS-I, identify the card again at 3.3V */
+		if ((sup_speed == p_hndl->sup_speed) || (_sd_card_reinit(p_hndl) != SD_OK)) {
+			return _sd_mount_error(p_hndl);  /* failed card initialize */
+		}
 	}
 
 	if (p_hndl->media_type & SD_MEDIA_MEM) {	/* with memory part */
@@ -208,6 +230,9 @@ int32_t sd_mount(int32_t sd_port, uint32_t mode, uint32_t voltage)
 
 		/* Cast to an appropriate type */
 		(void)_sd_calc_erase_sector(p_hndl);
+
+		/* ---- select the fastest bus speed mode (issue CMD6) ---- */
+		(void)_sd_card_switch_speed(p_hndl);
 	}
 
 	/* ---- set mount flag ---- */
@@ -350,6 +375,14 @@ int32_t _sd_card_init(st_sdhndl_t *p_hndl)
 		}
 	}
 
+	/* ---- switch to 1.8V signalling if the card accepted S18R (issue CMD11) ---- */
+	if ((p_hndl->media_type & SD_MEDIA_SD) && (p_hndl->ocr[0] & SD_OCR_S18R) &&
+			(p_hndl->sup_speed & (SD_MODE_SDR50 | SD_MODE_SDR104))) {
+		if (_sd_card_switch_volt(p_hndl) != SD_OK) {
+			return SD_ERR;
+		}
+	}
+
 	/* ---- get CID (issue CMD2) ---- */
 	if (_sd_card_send_cmd_arg(p_hndl, CMD2, SD_RSP_R2_CID, 0, 0) != SD_OK) {
 		return SD_ERR;
@@ -1043,4 +1076,368 @@ static int32_t _esd_get_partition_id(st_sdhndl_t *p_hndl, int32_t *id)
  * End of function _esd_get_partition_id
  *********************************************************************************************************************/
 
+/******************************************************************************
+ * Function Name: _sd_card_reinit
+ * Description  : initialize card again after a failed voltage switch.
+ *              : power cycle the card and identify it with 3.3V signalling
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ * Return Value : SD_OK : end of succeed
+ *              : SD_ERR: end of error
+ * Remark       : sddev_power_off/sddev_power_on must really cycle VDD for
+ *              : the card to leave 1.8V signalling
+ *****************************************************************************/
+static int32_t _sd_card_reinit(st_sdhndl_t *p_hndl)
+{
+	/* ---- turn off voltage ---- */
+	_sd_set_clock(p_hndl, 0, SD_CLOCK_DISABLE);
+	(void)sddev_set_voltage(p_hndl->sd_port, SD_VOLT_3_3);
+	p_hndl->sig_volt = SD_SIG_VOLT_3_3;
+	(void)sddev_power_off(p_hndl->sd_port);
+	mdelay(1);
+
+	/* ---- turn on voltage ---- */
+	if (sddev_power_on(p_hndl->sd_port) != SD_OK) {
+		_sd_set_err(p_hndl, SD_ERR_CPU_IF);
+		return SD_ERR;
+	}
+
+	p_hndl->media_type = SD_MEDIA_UNKNOWN;
+	p_hndl->error = SD_OK;
+
+	/* ---- set single port ---- */
+	_sd_set_port(p_hndl, SD_PORT_SERIAL);
+
+	/* ---- supply clock (card-identification ratio) ---- */
+	if (_sd_set_clock(p_hndl, SD_CLK_400KHZ, SD_CLOCK_ENABLE) != SD_OK) {
+		return SD_ERR;
+	}
+	mdelay(1);
+
+	return _sd_card_init(p_hndl);
+}
+/******************************************************************************
+ End of function _sd_card_reinit
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_switch_volt
+ * Description  : switch signalling voltage to 1.8V (issue CMD11).
+ *              : the card drives CMD and DAT[3:0] low after the response,
+ *              : the clock is halted while the IO voltage is switched and
+ *              : DAT0 going high again signals the card's success
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ * Return Value : SD_OK : end of succeed
+ *              : SD_ERR: end of error
+ * Remark       : on error UHS-I support is dropped from p_hndl->sup_speed
+ *****************************************************************************/
+static int32_t _sd_card_switch_volt(st_sdhndl_t *p_hndl)
+{
+	/* ---- issue CMD11 ---- */
+	if (_sd_card_send_cmd_arg(p_hndl, CMD11, SD_RSP_R1, 0, 0) != SD_OK) {
+		return _sd_card_switch_volt_error(p_hndl);
+	}
+
+	/* ---- halt clock, the bus is busy until the switch completes ---- */
+	/* Cast to an appropriate type */
+	SDMMC.SD_CLK_CTRL.LONGLONG = (SDMMC.SD_CLK_CTRL.LONGLONG & (~SD_CLK_CTRL_SCLKEN));
+
+	/* Cast to an appropriate type */
+	if (SDMMC.SD_INFO2.LONGLONG & SD_INFO2_MASK_DAT0) {
+		return _sd_card_switch_volt_error(p_hndl);   /* card didn't accept */
+	}
+
+	/* ---- switch IO voltage, keep the clock low for at least 5ms ---- */
+	if (sddev_set_voltage(p_hndl->sd_port, SD_VOLT_1_8) != SD_OK) {
+		return _sd_card_switch_volt_error(p_hndl);
+	}
+	p_hndl->sig_volt = SD_SIG_VOLT_1_8;
+	mdelay(5);
+
+	/* ---- supply clock, the card releases DAT0 within 1ms ---- */
+	/* Cast to an appropriate type */
+	SDMMC.SD_CLK_CTRL.LONGLONG = (SDMMC.SD_CLK_CTRL.LONGLONG | SD_CLK_CTRL_SCLKEN);
+	mdelay(1);
+
+	/* Cast to an appropriate type */
+	if ((SDMMC.SD_INFO2.LONGLONG & SD_INFO2_MASK_DAT0) == 0) {
+		return _sd_card_switch_volt_error(p_hndl);
+	}
+
+	return SD_OK;
+}
+/******************************************************************************
+ End of function _sd_card_switch_volt
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_switch_volt_error
+ * Description  : voltage switch error.
+ *              : drop UHS-I support so that the card is identified again
+ *              : with 3.3V signalling
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ * Return Value : SD_ERR: end of error
+ *****************************************************************************/
+static int32_t _sd_card_switch_volt_error(st_sdhndl_t *p_hndl)
+{
+	/* Cast to an appropriate type */
+	p_hndl->sup_speed &= (uint16_t)(~(SD_MODE_SDR50 | SD_MODE_SDR104));
+	_sd_set_err(p_hndl, SD_ERR_CARD_ERROR);
+	return SD_ERR;
+}
+/******************************************************************************
+ End of function _sd_card_switch_volt_error
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_switch_speed
+ * Description  : select bus speed mode.
+ *              : query the card's access modes (CMD6 check function) and
+ *              : switch to the fastest one enabled in p_hndl->sup_speed
+ *              : SDR104 -> SDR50 -> HS(SDR25) -> DS
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ * Return Value : SD_OK : end of succeed
+ * Remark       : on any error the card is left at the previous speed mode,
+ *              : the selected clock is set to p_hndl->csd_tran_speed
+ *****************************************************************************/
+static int32_t _sd_card_switch_speed(st_sdhndl_t *p_hndl)
+{
+	uint8_t  *p_rw_buff;
+	uint8_t  support;
+
+	/* switch function needs phys spec ver1.10 and command class 10 */
+	if ((SD_SPEC_10 == p_hndl->sd_spec) || ((p_hndl->csd_ccc & 0x0400u) == 0)) {
+		return SD_OK;
+	}
+	if ((p_hndl->sup_speed & (SD_MODE_HS | SD_MODE_SDR50 | SD_MODE_SDR104)) == 0) {
+		return SD_OK;
+	}
+
+	/* Cast to an appropriate type */
+	p_rw_buff = (uint8_t *)&s_stat_buff[p_hndl->sd_port][0];
+
+	/* ---- get supported functions (issue CMD6 mode 0) ---- */
+	if (_sd_read_byte(p_hndl, CMD6, SD_SWITCH_MODE_CHECK, (SD_SWITCH_GRP1_KEEP | 0x000Fu),
+			p_rw_buff, SD_SWITCH_FUNC_BYTE) != SD_OK) {
+		p_hndl->error = SD_OK;
+		return SD_OK;
+	}
+
+	support = p_rw_buff[SD_SWITCH_GRP1_SUPPORT];
+	if (support & (1u << SD_SWITCH_FUNC_HS)) {
+		p_hndl->speed_mode |= SD_SUP_HIGH_SPEED;
+	}
+	if (support & (1u << SD_SWITCH_FUNC_SDR50)) {
+		p_hndl->speed_mode |= SD_SUP_SDR50;
+	}
+	if (support & (1u << SD_SWITCH_FUNC_SDR104)) {
+		p_hndl->speed_mode |= SD_SUP_SDR104;
+	}
+
+	/* ---- UHS-I modes (1.8V signalling only) ---- */
+	if (SD_SIG_VOLT_1_8 == p_hndl->sig_volt) {
+		if ((p_hndl->sup_speed & SD_MODE_SDR104) && (p_hndl->speed_mode & SD_SUP_SDR104)) {
+			if (_sd_card_set_uhs(p_hndl, SD_SWITCH_FUNC_SDR104, SD_CLK_208MHZ) == SD_OK) {
+				p_hndl->speed_mode |= SD_CUR_SDR104;
+				return SD_OK;
+			}
+		}
+		if ((p_hndl->sup_speed & (SD_MODE_SDR50 | SD_MODE_SDR104)) && (p_hndl->speed_mode & SD_SUP_SDR50)) {
+			if (_sd_card_set_uhs(p_hndl, SD_SWITCH_FUNC_SDR50, SD_CLK_100MHZ) == SD_OK) {
+				p_hndl->speed_mode |= SD_CUR_SDR50;
+				return SD_OK;
+			}
+		}
+	}
+
+	/* ---- HS (3.3V) or SDR25 (1.8V), no tuning needed ---- */
+	if (p_hndl->speed_mode & SD_SUP_HIGH_SPEED) {
+		if (_sd_card_set_func(p_hndl, SD_SWITCH_FUNC_HS) == SD_OK) {
+			p_hndl->csd_tran_speed = SD_CLK_50MHZ;
+			p_hndl->speed_mode |= SD_CUR_HIGH_SPEED;
+		}
+	}
+
+	/* Cast to an appropriate type */
+	(void)_sd_set_clock(p_hndl, (int32_t)p_hndl->csd_tran_speed, SD_CLOCK_ENABLE);
+	p_hndl->error = SD_OK;
+
+	return SD_OK;
+}
+/******************************************************************************
+ End of function _sd_card_switch_speed
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_set_func
+ * Description  : switch access mode (issue CMD6 mode 1).
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ *              : uint32_t func       : function group 1 number
+ * Return Value : SD_OK : end of succeed
+ *              : SD_ERR: end of error
+ * Remark       : issued at the identification safe SD_CLK_25MHZ so that
+ *              : an untuned sampling point can't corrupt the status data
+ *****************************************************************************/
+static int32_t _sd_card_set_func(st_sdhndl_t *p_hndl, uint32_t func)
+{
+	uint8_t  *p_rw_buff;
+
+	/* Cast to an appropriate type */
+	p_rw_buff = (uint8_t *)&s_stat_buff[p_hndl->sd_port][0];
+
+	_sd_scc_disable(p_hndl);
+	if (_sd_set_clock(p_hndl, SD_CLK_25MHZ, SD_CLOCK_ENABLE) != SD_OK) {
+		return SD_ERR;
+	}
+
+	/* Cast to an appropriate type */
+	if (_sd_read_byte(p_hndl, CMD6, SD_SWITCH_MODE_SET, (uint16_t)(SD_SWITCH_GRP1_KEEP | func),
+			p_rw_buff, SD_SWITCH_FUNC_BYTE) != SD_OK) {
+		p_hndl->error = SD_OK;
+		return SD_ERR;
+	}
+
+	if ((p_rw_buff[SD_SWITCH_GRP1_RESULT] & 0x0Fu) != func) {
+		return SD_ERR;
+	}
+
+	return SD_OK;
+}
+/******************************************************************************
+ End of function _sd_card_set_func
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_set_uhs
+ * Description  : switch to an UHS-I mode and tune the sampling clock.
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ *              : uint32_t func       : SD_SWITCH_FUNC_SDR50 or SD_SWITCH_FUNC_SDR104
+ *              : int32_t clock       : SD_CLK_100MHZ or SD_CLK_208MHZ
+ * Return Value : SD_OK : end of succeed
+ *              : SD_ERR: end of error
+ *****************************************************************************/
+static int32_t _sd_card_set_uhs(st_sdhndl_t *p_hndl, uint32_t func, int32_t clock)
+{
+	if (_sd_card_set_func(p_hndl, func) != SD_OK) {
+		return SD_ERR;
+	}
+
+	if (_sd_card_tuning(p_hndl, clock) != SD_OK) {
+		p_hndl->error = SD_OK;
+		return SD_ERR;
+	}
+
+	/* Cast to an appropriate type */
+	p_hndl->csd_tran_speed = (uint8_t)clock;
+
+	return SD_OK;
+}
+/******************************************************************************
+ End of function _sd_card_set_uhs
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_card_tuning
+ * Description  : tune the SCC sampling clock (issue CMD19).
+ *              : read the tuning block on every tap twice, so that a window
+ *              : may wrap past tap 0, and sample in the middle of the
+ *              : longest run of good taps with auto correction enabled
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ *              : int32_t clock       : SD clock frequency
+ * Return Value : SD_OK : end of succeed
+ *              : SD_ERR: end of error
+ * Remark       : on error the sampling clock is returned to SDHI
+ *****************************************************************************/
+static int32_t _sd_card_tuning(st_sdhndl_t *p_hndl, int32_t clock)
+{
+	uint8_t  *p_rw_buff;
+	uint32_t tap_num;
+	uint32_t ntap;
+	uint32_t i;
+	uint32_t good_taps = 0;
+	uint32_t start = 0;
+	uint32_t len = 0;
+	uint32_t best_start = 0;
+	uint32_t best_len = 0;
+
+	/* Cast to an appropriate type */
+	p_rw_buff = (uint8_t *)&s_stat_buff[p_hndl->sd_port][0];
+
+	/* ---- select SCC sampling clock (with SD clock halted) ---- */
+	_sd_set_clock(p_hndl, 0, SD_CLOCK_DISABLE);
+	SDMMC.SCC_DTCNTL.LONG = (SDMMC.SCC_DTCNTL.LONG | SD_SCC_DTCNTL_TAPEN);
+	SDMMC.SCC_CKSEL.LONG = (SDMMC.SCC_CKSEL.LONG | SD_SCC_CKSEL_DTSEL);
+	SDMMC.SCC_RVSCNTL.LONG = (SDMMC.SCC_RVSCNTL.LONG & (~SD_SCC_RVSCNTL_RVSEN));
+	SDMMC.SCC_DT2FF.LONG = SD_SCC_DT2FF_TAPPOS;
+	if (_sd_set_clock(p_hndl, clock, SD_CLOCK_ENABLE) != SD_OK) {
+		_sd_scc_disable(p_hndl);
+		return SD_ERR;
+	}
+
+	tap_num = (SDMMC.SCC_DTCNTL.LONG >> SD_SCC_DTCNTL_TAPNUM_SHIFT) & SD_SCC_DTCNTL_TAPNUM_MASK;
+	if ((0 == tap_num) || (tap_num > SD_SCC_TAP_MAX)) {
+		_sd_scc_disable(p_hndl);
+		return SD_ERR;
+	}
+	ntap = tap_num * 2;
+
+	for (i = 0; i < ntap; i++) {
+		SDMMC.SCC_TAPSET.LONG = (i % tap_num);
+		if ((_sd_read_byte(p_hndl, CMD19, 0, 0, p_rw_buff, SD_TUNING_BLOCK_BYTE) == SD_OK) &&
+				(0 == SDMMC.SCC_SMPCMP.LONG)) {
+			good_taps |= (1u << i);
+		}
+		p_hndl->error = SD_OK;
+	}
+
+	/* ---- longest run of good taps ---- */
+	for (i = 0; i < ntap; i++) {
+		if ((good_taps & (1u << i)) == 0) {
+			len = 0;
+			continue;
+		}
+		if (0 == len) {
+			start = i;
+		}
+		len++;
+		if (len > best_len) {
+			best_start = start;
+			best_len = len;
+		}
+	}
+
+	if (best_len < SD_TUNING_MIN_WINDOW) {
+		_sd_scc_disable(p_hndl);
+		return SD_ERR;
+	}
+
+	/* Cast to an appropriate type */
+	p_hndl->tuning_tap = (uint8_t)((best_start + (best_len / 2)) % tap_num);
+	SDMMC.SCC_TAPSET.LONG = p_hndl->tuning_tap;
+	SDMMC.SCC_RVSREQ.LONG = 0;
+	SDMMC.SCC_RVSCNTL.LONG = (SDMMC.SCC_RVSCNTL.LONG | SD_SCC_RVSCNTL_RVSEN);
+
+	return SD_OK;
+}
+/******************************************************************************
+ End of function _sd_card_tuning
+ *****************************************************************************/
+
+/******************************************************************************
+ * Function Name: _sd_scc_disable
+ * Description  : return the sampling clock from SCC to SDHI.
+ * Arguments    : st_sdhndl_t *p_hndl : SD handle
+ * Return Value : none
+ * Remark       : the SD clock is left halted
+ *****************************************************************************/
+static void _sd_scc_disable(st_sdhndl_t *p_hndl)
+{
+	_sd_set_clock(p_hndl, 0, SD_CLOCK_DISABLE);
+	SDMMC.SCC_RVSCNTL.LONG = (SDMMC.SCC_RVSCNTL.LONG & (~SD_SCC_RVSCNTL_RVSEN));
+	SDMMC.SCC_CKSEL.LONG = (SDMMC.SCC_CKSEL.LONG & (~SD_SCC_CKSEL_DTSEL));
+	SDMMC.SCC_DTCNTL.LONG = (SDMMC.SCC_DTCNTL.LONG & (~SD_SCC_DTCNTL_TAPEN));
+}
+/******************************************************************************
+ End of function _sd_scc_disable
+ *****************************************************************************/
+
 /* End of File */
@@ -5,6 +5,7 @@
  */
 
 #include <stdint.h>
+#include <common/debug.h>
 #include <lib/utils_def.h>
 #include <lib/mmio.h>
 #include <arch_helpers.h>
@@ -108,8 +109,25 @@ void spi_multi_cmd_write(uint8_t command, uint8_t size, uint32_t data)
 	} while ((val & CMNSR_TEND) == 0);
 }
 
+#if PLAT_SPI_MULTI_SFDP
+static void spi_multi_report_read_cfg(const spi_multi_read_cfg_t *cfg)
+{
+	static const char *const dq_wides[] = {
+		[SPI_MULTI_DQ_WIDES_1_1_1] = "1-1-1",
+		[SPI_MULTI_DQ_WIDES_1_1_4] = "1-1-4",
+		[SPI_MULTI_DQ_WIDES_1_4_4] = "1-4-4",
+	};
+
+	NOTICE("BL2: SPI flash SFDP read %s, cmd 0x%x, %u-bit address, %u dummy cycles\n",
+	       dq_wides[cfg->dq_wides], (cfg->drcmr >> SMCMR_CMD_BIT_SHIFT) & 0xFFU,
+	       (cfg->addr_wides == SPI_MULTI_ADDR_WIDES_32) ? 32U : 24U,
+	       cfg->dummy);
+}
+#endif
+
 int spi_multi_setup(void)
 {
+	spi_multi_read_cfg_t cfg;
 	uint32_t val;
 
 	/* Wait until the transfer is complete */
@@ -119,6 +137,21 @@ int spi_multi_setup(void)
 
 	/* Device-specific settings */
 	spi_multi_setup_device();
+
+	/* Build-time read settings, replaced by the SFDP ones when usable */
+	cfg.drcmr = SPIM_DRCMR_SET_VALUE;
+	cfg.drear = SPIM_DREAR_SET_VALUE;
+	cfg.dropr = mmio_read_32(SPIM_DROPR);
+	cfg.drenr = SPIM_DRENR_SET_VALUE;
+	cfg.drdmcr = SPIM_DRDMCR_SET_VALUE;
+#if PLAT_SPI_MULTI_SFDP
+	if (spi_multi_sfdp_setup(&cfg) == SPI_MULTI_SUCCESS) {
+		spi_multi_report_read_cfg(&cfg);
+	} else {
+		NOTICE("BL2: SPI flash SFDP not usable, using build-time read settings\n");
+	}
+#endif
+
 	/* SDR mode serial flash settings */
 	mmio_write_32(SPIM_PHYCNT, SPIM_PHYCNT_SET_VALUE);
 
@@ -136,17 +169,19 @@ int spi_multi_setup(void)
 	mmio_read_32(SPIM_DRCR);
 
 	/* Set the data read command */
-	mmio_write_32(SPIM_DRCMR, SPIM_DRCMR_SET_VALUE);
+	mmio_write_32(SPIM_DRCMR, cfg.drcmr);
 
 	/* Extended external address setting */
-	mmio_write_32(SPIM_DREAR, SPIM_DREAR_SET_VALUE);
+	mmio_write_32(SPIM_DREAR, cfg.drear);
+
+	/* Set the data read option (mode bits) */
+	mmio_write_32(SPIM_DROPR, cfg.dropr);
 
-	/* Set the bit width of command and address output to 1 bit and	*/
-	/* the address size to 4 byte									*/
-	mmio_write_32(SPIM_DRENR, SPIM_DRENR_SET_VALUE);
+	/* Set the bit width of command, address and data and the address size */
+	mmio_write_32(SPIM_DRENR, cfg.drenr);
 
 	/* Dummy cycle setting */
-	mmio_write_32(SPIM_DRDMCR, SPIM_DRDMCR_SET_VALUE);
+	mmio_write_32(SPIM_DRDMCR, cfg.drdmcr);
 
 	/* Change to SPI flash mode */
 	mmio_write_32(SPIM_DRDRENR, SPIM_DRDRENR_SET_VALUE);
@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <drivers/delay_timer.h>
+#include <lib/utils_def.h>
+#include <lib/mmio.h>
+#include <arch_helpers.h>
+#include <spi_multi_regs.h>
+#include <spi_multi.h>
+#include <spi_multi_reg_values.h>
+
+/* Serial Flash Discoverable Parameters (JESD216) */
+#define SFDP_SIGNATURE				(0x50444653U)	/* "SFDP" */
+#define SFDP_MAJOR_REV				(1U)
+#define SFDP_PARAM_HDR_OFFSET		(0x08U)
+#define SFDP_PARAM_HDR_SIZE			(0x08U)
+#define SFDP_PARAM_HDR_MAX			(16U)
+#define SFDP_PARAM_ID_BFPT			(0xFF00U)
+#define SFDP_PARAM_ID_4BAIT			(0xFF84U)
+
+#define SFDP_BFPT_DWORDS_MAX		(16U)
+#define SFDP_BFPT_DWORDS_REV_A		(9U)
+#define SFDP_BFPT_DWORDS_REV_B		(16U)
+
+/* BFPT 1st DWORD */
+#define BFPT_DW1_ADDR_BYTES_SHIFT	(17U)
+#define BFPT_DW1_ADDR_BYTES_MASK	(0x3U)
+#define BFPT_DW1_ADDR_BYTES_3		(0U)
+#define BFPT_DW1_ADDR_BYTES_4		(2U)
+#define BFPT_DW1_FAST_READ_1_4_4	BIT_32(21)
+#define BFPT_DW1_FAST_READ_1_1_4	BIT_32(22)
+/* BFPT 2nd DWORD */
+#define BFPT_DW2_DENSITY_POW2		BIT_32(31)
+/* BFPT 3rd DWORD */
+#define BFPT_DW3_1_4_4_SHIFT		(0U)
+#define BFPT_DW3_1_1_4_SHIFT		(16U)
+/* BFPT 15th DWORD */
+#define BFPT_DW15_QER_SHIFT			(20U)
+#define BFPT_DW15_QER_MASK			(0x7U)
+/* BFPT 16th DWORD: the status register can be written volatile after 50h */
+#define BFPT_DW16_SR_VOLATILE_50H	BIT_32(2)
+#define BFPT_DW16_SR_NV_VOLATILE_50H	BIT_32(3)
+
+/* 4-byte Address Instruction Table 1st DWORD */
+#define FBAIT_DW1_FAST_READ_1_1_1	BIT_32(1)
+#define FBAIT_DW1_FAST_READ_1_1_4	BIT_32(4)
+#define FBAIT_DW1_FAST_READ_1_4_4	BIT_32(5)
+
+/* Quad Enable Requirements */
+#define SFDP_QER_NONE				(0U)
+#define SFDP_QER_SR2_BIT1_NO_RD		(1U)
+#define SFDP_QER_SR1_BIT6			(2U)
+#define SFDP_QER_SR2_BIT7			(3U)
+#define SFDP_QER_SR2_BIT1_NO_RD_ALT	(4U)
+#define SFDP_QER_SR2_BIT1_RD_35		(5U)
+#define SFDP_QER_SR2_BIT1_WR_31		(6U)
+
+/* Manual Command */
+#define SFDP_CMD_READ_SFDP			(0x5A)
+#define SFDP_CMD_WRITE_ENABLE		(0x06)
+#define SFDP_CMD_WRITE_ENABLE_VSR	(0x50)
+#define SFDP_CMD_READ_SR1			(0x05)
+#define SFDP_CMD_READ_SR2			(0x35)
+#define SFDP_CMD_READ_SR2_3F		(0x3F)
+#define SFDP_CMD_WRITE_SR			(0x01)
+#define SFDP_CMD_WRITE_SR2			(0x31)
+#define SFDP_CMD_WRITE_SR2_3E		(0x3E)
+#define SFDP_CMD_FAST_READ_3B		(0x0B)
+#define SFDP_CMD_FAST_READ_4B		(0x0C)
+#define SFDP_CMD_QUAD_OUTPUT_4B		(0x6C)
+#define SFDP_CMD_QUAD_IO_4B			(0xEC)
+#define SFDP_READ_SFDP_DUMMY		SPI_MULTI_DUMMY_8CYCLE
+#define SFDP_FAST_READ_DUMMY		(8U)
+#define SFDP_DUMMY_MAX				(20U)
+#define SMWDR0_2BYTE_DATA_BIT_SHIFT	(16)
+
+#define SFDP_SR1_WIP				BIT_32(0)
+#define SFDP_SR1_QE_BIT6			BIT_32(6)
+#define SFDP_SR2_QE_BIT1			BIT_32(1)
+#define SFDP_SR2_QE_BIT7			BIT_32(7)
+
+/* Busy polling after a status register write, 1s in total */
+#define SFDP_WIP_POLL_DELAY_US		(100U)
+#define SFDP_WIP_POLL_COUNT			(10000U)
+
+/* Option data driven while the mode clocks are output: no continuous read */
+#define SFDP_MODE_BYTE_VALUE		(0xFFU << 24)
+
+#define SFDP_3B_ADDR_SIZE_LOG2		(24U)
+
+static bool sfdp_swap;
+
+/* Read one dword with a 1-1-1 or 1-1-4 command taking a 24bit address */
+static uint32_t spi_multi_sfdp_read_data(uint8_t command, uint32_t addr,
+					 uint32_t dummy, uint32_t data_bits)
+{
+	uint32_t val;
+
+	/* SDR mode serial flash settings */
+	mmio_write_32(SPIM_PHYCNT, SPIM_PHYCNT_SET_VALUE);
+	mmio_write_32(SPIM_PHYCNT, SPIM_PHYCNT_SDR_TIM_ADJ_SET_VALUE);
+
+	/* Set the QSPIn_SSL setting value & Manual Mode */
+	mmio_write_32(SPIM_CMNCR, SPIM_CMNCR_MANUAL_SET_VALUE);
+
+	val = (uint32_t)command << SMCMR_CMD_BIT_SHIFT;
+	mmio_write_32(SPIM_SMCMR, val);
+	mmio_write_32(SPIM_SMADR, addr);
+	mmio_write_32(SPIM_SMDMCR, dummy - 1U);
+
+	val = SMENR_CDE | SMENR_ADE_ADR23_0_OUT | SMENR_DME | data_bits |
+	      SPI_MANUAL_COMMAND_SIZE_32_BIT;
+	mmio_write_32(SPIM_SMENR, val);
+
+	/* Set the SDR transfer & SPI flash mode setting value */
+	mmio_write_32(SPIM_SMDRENR, SPIM_SMDRENR_SET_VALUE);
+
+	val = SMCR_SPIE | SMCR_SPIRE;
+	mmio_write_32(SPIM_SMCR, val);
+
+	/* Wait until the transfer is complete */
+	do {
+		val = mmio_read_32(SPIM_CMNSR);
+	} while ((val & CMNSR_TEND) == 0);
+
+	val = mmio_read_32(SPIM_SMRDR0);
+
+	return sfdp_swap ? __builtin_bswap32(val) : val;
+}
+
+static uint32_t spi_multi_sfdp_read_dword(uint32_t addr)
+{
+	/* Read SFDP is always 1-1-1 with a 24bit address and 8 dummy cycles */
+	return spi_multi_sfdp_read_data(SFDP_CMD_READ_SFDP, addr,
+					SFDP_READ_SFDP_DUMMY + 1U,
+					SMENR_SPIDB_1BIT);
+}
+
+static void spi_multi_sfdp_read(uint32_t addr, uint32_t *buf, uint32_t dwords)
+{
+	uint32_t i;
+
+	for (i = 0; i < dwords; i++) {
+		buf[i] = spi_multi_sfdp_read_dword(addr + (i * 4U));
+	}
+}
+
+static int spi_multi_sfdp_write_reg(uint8_t wren, uint8_t command,
+				    uint8_t size, uint32_t data)
+{
+	uint32_t retry;
+
+	/* Write Enable Command, 50h for the volatile status register */
+	spi_multi_cmd_write(wren, SPI_MANUAL_COMMAND_SIZE_0, 0);
+	spi_multi_cmd_write(command, size, data);
+
+	for (retry = 0; retry < SFDP_WIP_POLL_COUNT; retry++) {
+		if ((spi_multi_cmd_read(SFDP_CMD_READ_SR1) & SFDP_SR1_WIP) == 0) {
+			return SPI_MULTI_SUCCESS;
+		}
+		udelay(SFDP_WIP_POLL_DELAY_US);
+	}
+
+	return SPI_MULTI_ERROR;
+}
+
+static int spi_multi_sfdp_write_status(uint8_t command, uint8_t size,
+				       uint32_t data)
+{
+	return spi_multi_sfdp_write_reg(SFDP_CMD_WRITE_ENABLE, command, size,
+					data);
+}
+
+/*
+ * Tell whether the 1-1-4 read of BFPT DWORD 3 already returns what FAST_READ
+ * does, i.e. whether the Quad Enable bit is set. The first flash bytes hold
+ * the boot image; if they are all 0s or all 1s the answer is no.
+ */
+static bool spi_multi_sfdp_quad_works(const uint32_t *bfpt)
+{
+	uint32_t entry = bfpt[2] >> BFPT_DW3_1_1_4_SHIFT;
+	uint32_t wait = entry & 0x1FU;
+	uint32_t ref;
+	uint32_t addr;
+	bool seen = false;
+
+	if (((bfpt[0] & BFPT_DW1_FAST_READ_1_1_4) == 0) ||
+	    (((entry >> 5) & 0x7U) != 0) || (wait == 0) ||
+	    (wait > SFDP_DUMMY_MAX)) {
+		return false;
+	}
+
+	for (addr = 0; addr < 8U; addr += 4U) {
+		ref = spi_multi_sfdp_read_data(SFDP_CMD_FAST_READ_3B, addr,
+					       SFDP_FAST_READ_DUMMY,
+					       SMENR_SPIDB_1BIT);
+		if (spi_multi_sfdp_read_data((uint8_t)(entry >> 8), addr, wait,
+					     SMENR_SPIDB_4BIT) != ref) {
+			return false;
+		}
+		seen |= (ref != 0U) && (ref != ~0U);
+	}
+
+	return seen;
+}
+
+/* Set the Quad Enable bit the way BFPT DWORD 15 tells us to */
+static int spi_multi_sfdp_quad_enable(const uint32_t *bfpt)
+{
+	uint32_t qer = (bfpt[14] >> BFPT_DW15_QER_SHIFT) & BFPT_DW15_QER_MASK;
+	uint8_t sr1;
+	uint8_t sr2;
+	uint32_t val;
+
+	switch (qer) {
+	case SFDP_QER_NONE:
+		return SPI_MULTI_SUCCESS;
+
+	case SFDP_QER_SR2_BIT1_NO_RD:
+	case SFDP_QER_SR2_BIT1_NO_RD_ALT:
+		if (spi_multi_sfdp_quad_works(bfpt)) {
+			return SPI_MULTI_SUCCESS;
+		}
+		/*
+		 * SR2 cannot be read, so writing QE would clear the other SR2
+		 * bits. Only do it in the volatile copy, which the next power
+		 * cycle reloads from the non-volatile register.
+		 */
+		if ((bfpt[15] & (BFPT_DW16_SR_VOLATILE_50H |
+				 BFPT_DW16_SR_NV_VOLATILE_50H)) == 0) {
+			return SPI_MULTI_ERROR;
+		}
+		sr1 = spi_multi_cmd_read(SFDP_CMD_READ_SR1);
+		val = ((uint32_t)sr1 << SMWDR0_1BYTE_DATA_BIT_SHIFT) |
+		      (SFDP_SR2_QE_BIT1 << SMWDR0_2BYTE_DATA_BIT_SHIFT);
+		return spi_multi_sfdp_write_reg(SFDP_CMD_WRITE_ENABLE_VSR,
+						SFDP_CMD_WRITE_SR,
+						SPI_MANUAL_COMMAND_SIZE_16_BIT, val);
+
+	case SFDP_QER_SR1_BIT6:
+		sr1 = spi_multi_cmd_read(SFDP_CMD_READ_SR1);
+		if ((sr1 & SFDP_SR1_QE_BIT6) != 0) {
+			return SPI_MULTI_SUCCESS;
+		}
+		val = (uint32_t)(sr1 | SFDP_SR1_QE_BIT6) << SMWDR0_1BYTE_DATA_BIT_SHIFT;
+		if (spi_multi_sfdp_write_status(SFDP_CMD_WRITE_SR,
+						SPI_MANUAL_COMMAND_SIZE_8_BIT, val) != SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_ERROR;
+		}
+		sr1 = spi_multi_cmd_read(SFDP_CMD_READ_SR1);
+		return ((sr1 & SFDP_SR1_QE_BIT6) != 0) ? SPI_MULTI_SUCCESS : SPI_MULTI_ERROR;
+
+	case SFDP_QER_SR2_BIT7:
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2_3F);
+		if ((sr2 & SFDP_SR2_QE_BIT7) != 0) {
+			return SPI_MULTI_SUCCESS;
+		}
+		val = (uint32_t)(sr2 | SFDP_SR2_QE_BIT7) << SMWDR0_1BYTE_DATA_BIT_SHIFT;
+		if (spi_multi_sfdp_write_status(SFDP_CMD_WRITE_SR2_3E,
+						SPI_MANUAL_COMMAND_SIZE_8_BIT, val) != SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_ERROR;
+		}
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2_3F);
+		return ((sr2 & SFDP_SR2_QE_BIT7) != 0) ? SPI_MULTI_SUCCESS : SPI_MULTI_ERROR;
+
+	case SFDP_QER_SR2_BIT1_RD_35:
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2);
+		if ((sr2 & SFDP_SR2_QE_BIT1) != 0) {
+			return SPI_MULTI_SUCCESS;
+		}
+		sr1 = spi_multi_cmd_read(SFDP_CMD_READ_SR1);
+		val = ((uint32_t)sr1 << SMWDR0_1BYTE_DATA_BIT_SHIFT) |
+		      ((uint32_t)(sr2 | SFDP_SR2_QE_BIT1) << SMWDR0_2BYTE_DATA_BIT_SHIFT);
+		if (spi_multi_sfdp_write_status(SFDP_CMD_WRITE_SR,
+						SPI_MANUAL_COMMAND_SIZE_16_BIT, val) != SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_ERROR;
+		}
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2);
+		return ((sr2 & SFDP_SR2_QE_BIT1) != 0) ? SPI_MULTI_SUCCESS : SPI_MULTI_ERROR;
+
+	case SFDP_QER_SR2_BIT1_WR_31:
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2);
+		if ((sr2 & SFDP_SR2_QE_BIT1) != 0) {
+			return SPI_MULTI_SUCCESS;
+		}
+		val = (uint32_t)(sr2 | SFDP_SR2_QE_BIT1) << SMWDR0_1BYTE_DATA_BIT_SHIFT;
+		if (spi_multi_sfdp_write_status(SFDP_CMD_WRITE_SR2,
+						SPI_MANUAL_COMMAND_SIZE_8_BIT, val) != SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_ERROR;
+		}
+		sr2 = spi_multi_cmd_read(SFDP_CMD_READ_SR2);
+		return ((sr2 & SFDP_SR2_QE_BIT1) != 0) ? SPI_MULTI_SUCCESS : SPI_MULTI_ERROR;
+
+	default:
+		return SPI_MULTI_ERROR;
+	}
+}
+
+/* log2 of the device size in bytes, from BFPT DWORD 2 */
+static uint32_t spi_multi_sfdp_size_log2(uint32_t density)
+{
+	uint64_t bits;
+	uint32_t log2 = 0;
+
+	if ((density & BFPT_DW2_DENSITY_POW2) != 0) {
+		return (density & ~BFPT_DW2_DENSITY_POW2) - 3U;
+	}
+
+	bits = (uint64_t)density + 1U;
+	while ((bits >> (log2 + 4U)) != 0) {
+		log2++;
+	}
+
+	return log2;
+}
+
+/*
+ * Turn one fast read entry into SPIM data read register values.
+ * Mode clocks wide enough for a whole byte are driven through OPD3 with
+ * SFDP_MODE_BYTE_VALUE, anything left over is counted as dummy cycles.
+ */
+static int spi_multi_sfdp_fill(spi_multi_read_cfg_t *cfg, uint8_t opcode,
+			       uint32_t addr_width, uint32_t data_width,
+			       uint32_t wait, uint32_t mode_clk, bool addr32,
+			       uint32_t size_log2)
+{
+	uint32_t dummy = wait;
+	uint32_t drenr = DRENR_CDB_1BIT | DRENR_OCDB_1BIT | DRENR_CDE;
+	uint32_t eac;
+
+	if (addr_width == 4U) {
+		drenr |= DRENR_ADB_4BIT | DRENR_OPDB_4BIT;
+	}
+	if (data_width == 4U) {
+		drenr |= DRENR_DRDB_4BIT;
+	}
+
+	cfg->dropr = 0;
+	if ((mode_clk * addr_width) >= 8U) {
+		drenr |= DRENR_OPDE_OPD3_OUT;
+		cfg->dropr = SFDP_MODE_BYTE_VALUE;
+		dummy += mode_clk - (8U / addr_width);
+	} else {
+		dummy += mode_clk;
+	}
+
+	if (dummy > SFDP_DUMMY_MAX) {
+		return SPI_MULTI_ERROR;
+	}
+	if (dummy != 0) {
+		drenr |= DRENR_DME;
+		cfg->drdmcr = dummy - 1U;
+	} else {
+		cfg->drdmcr = 0;
+	}
+
+	if (addr32) {
+		drenr |= DRENR_ADE_ADD31_OUT;
+		eac = (size_log2 > (SFDP_3B_ADDR_SIZE_LOG2 + 1U)) ?
+		      (size_log2 - (SFDP_3B_ADDR_SIZE_LOG2 + 1U)) : 0U;
+		cfg->drear = MIN(eac, (uint32_t)DREAR_EAC_EXADDR27);
+		cfg->addr_wides = SPI_MULTI_ADDR_WIDES_32;
+	} else {
+		drenr |= DRENR_ADE_ADD23_OUT;
+		cfg->drear = DREAR_EAC_EXADDR24;
+		cfg->addr_wides = SPI_MULTI_ADDR_WIDES_24;
+	}
+
+	cfg->drcmr = (uint32_t)opcode << SMCMR_CMD_BIT_SHIFT;
+	cfg->drenr = drenr;
+	cfg->dummy = dummy;
+
+	return SPI_MULTI_SUCCESS;
+}
+
+/*
+ * Pick the widest read the BFPT advertises. A device larger than 16MiB
+ * gets the dedicated 4-byte address opcodes when the 4BAIT lists them,
+ * otherwise reads stay in the first 16MiB as with the static settings.
+ */
+static int spi_multi_sfdp_select(const uint32_t *bfpt, uint32_t fbait,
+				 bool quad, spi_multi_read_cfg_t *cfg)
+{
+	uint32_t addr_bytes;
+	uint32_t size_log2;
+	uint32_t entry;
+	uint8_t opcode;
+	bool big;
+	bool addr32;
+
+	addr_bytes = (bfpt[0] >> BFPT_DW1_ADDR_BYTES_SHIFT) & BFPT_DW1_ADDR_BYTES_MASK;
+	size_log2 = spi_multi_sfdp_size_log2(bfpt[1]);
+	big = (size_log2 > SFDP_3B_ADDR_SIZE_LOG2) &&
+	      (addr_bytes != BFPT_DW1_ADDR_BYTES_3);
+	addr32 = (addr_bytes == BFPT_DW1_ADDR_BYTES_4);
+
+	if (quad && ((bfpt[0] & BFPT_DW1_FAST_READ_1_4_4) != 0)) {
+		entry = bfpt[2] >> BFPT_DW3_1_4_4_SHIFT;
+		opcode = (uint8_t)(entry >> 8);
+		if (big && !addr32 && ((fbait & FBAIT_DW1_FAST_READ_1_4_4) != 0)) {
+			opcode = SFDP_CMD_QUAD_IO_4B;
+			addr32 = true;
+		}
+		cfg->dq_wides = SPI_MULTI_DQ_WIDES_1_4_4;
+		if (spi_multi_sfdp_fill(cfg, opcode, 4U, 4U, entry & 0x1FU,
+					(entry >> 5) & 0x7U, addr32,
+					size_log2) == SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_SUCCESS;
+		}
+		addr32 = (addr_bytes == BFPT_DW1_ADDR_BYTES_4);
+	}
+
+	if (quad && ((bfpt[0] & BFPT_DW1_FAST_READ_1_1_4) != 0)) {
+		entry = bfpt[2] >> BFPT_DW3_1_1_4_SHIFT;
+		opcode = (uint8_t)(entry >> 8);
+		if (big && !addr32 && ((fbait & FBAIT_DW1_FAST_READ_1_1_4) != 0)) {
+			opcode = SFDP_CMD_QUAD_OUTPUT_4B;
+			addr32 = true;
+		}
+		cfg->dq_wides = SPI_MULTI_DQ_WIDES_1_1_4;
+		if (spi_multi_sfdp_fill(cfg, opcode, 1U, 4U, entry & 0x1FU,
+					(entry >> 5) & 0x7U, addr32,
+					size_log2) == SPI_MULTI_SUCCESS) {
+			return SPI_MULTI_SUCCESS;
+		}
+		addr32 = (addr_bytes == BFPT_DW1_ADDR_BYTES_4);
+	}
+
+	/* FAST_READ is mandatory and always uses 8 dummy cycles */
+	opcode = SFDP_CMD_FAST_READ_3B;
+	if (big && !addr32 && ((fbait & FBAIT_DW1_FAST_READ_1_1_1) != 0)) {
+		opcode = SFDP_CMD_FAST_READ_4B;
+		addr32 = true;
+	}
+	cfg->dq_wides = SPI_MULTI_DQ_WIDES_1_1_1;
+
+	return spi_multi_sfdp_fill(cfg, opcode, 1U, 1U, SFDP_FAST_READ_DUMMY,
+				   0U, addr32, size_log2);
+}
+
+/*
+ * Read the JESD216 parameter tables of the boot flash and derive the
+ * external address space read settings from them. On any error cfg is
+ * left untouched so the caller keeps the build-time settings.
+ */
+int spi_multi_sfdp_setup(spi_multi_read_cfg_t *cfg)
+{
+	spi_multi_read_cfg_t sfdp_cfg;
+	uint32_t bfpt[SFDP_BFPT_DWORDS_MAX] = { 0 };
+	uint32_t hdr[2];
+	uint32_t bfpt_ptr = 0;
+	uint32_t bfpt_len = 0;
+	uint32_t bfpt_minor = 0;
+	uint32_t fbait_ptr = 0;
+	uint32_t fbait = 0;
+	uint32_t nph;
+	uint32_t id;
+	uint32_t i;
+	bool quad;
+
+	/* The signature also tells us the byte order of SMRDR0 */
+	sfdp_swap = false;
+	hdr[0] = spi_multi_sfdp_read_dword(0);
+	if (hdr[0] != SFDP_SIGNATURE) {
+		if (__builtin_bswap32(hdr[0]) != SFDP_SIGNATURE) {
+			return SPI_MULTI_ERROR;
+		}
+		sfdp_swap = true;
+	}
+
+	hdr[1] = spi_multi_sfdp_read_dword(4);
+	if (((hdr[1] >> 8) & 0xFFU) != SFDP_MAJOR_REV) {
+		return SPI_MULTI_ERROR;
+	}
+	nph = MIN(((hdr[1] >> 16) & 0xFFU) + 1U, SFDP_PARAM_HDR_MAX);
+
+	for (i = 0; i < nph; i++) {
+		spi_multi_sfdp_read(SFDP_PARAM_HDR_OFFSET + (i * SFDP_PARAM_HDR_SIZE),
+				    hdr, 2);
+		if (((hdr[0] >> 16) & 0xFFU) != SFDP_MAJOR_REV) {
+			continue;
+		}
+		id = ((hdr[1] >> 16) & 0xFF00U) | (hdr[0] & 0xFFU);
+		if ((id == SFDP_PARAM_ID_BFPT) &&
+		    ((bfpt_ptr == 0) || (((hdr[0] >> 8) & 0xFFU) >= bfpt_minor))) {
+			bfpt_ptr = hdr[1] & 0x00FFFFFFU;
+			bfpt_len = hdr[0] >> 24;
+			bfpt_minor = (hdr[0] >> 8) & 0xFFU;
+		} else if (id == SFDP_PARAM_ID_4BAIT) {
+			fbait_ptr = hdr[1] & 0x00FFFFFFU;
+		}
+	}
+
+	if ((bfpt_ptr == 0) || (bfpt_len < SFDP_BFPT_DWORDS_REV_A)) {
+		return SPI_MULTI_ERROR;
+	}
+	/*
+	 * Without the JESD216B Quad Enable Requirements there is no generic
+	 * way to make quad reads safe, so leave such parts to the build-time
+	 * settings and their device-specific setup.
+	 */
+	if (bfpt_len < SFDP_BFPT_DWORDS_REV_B) {
+		return SPI_MULTI_ERROR;
+	}
+	spi_multi_sfdp_read(bfpt_ptr, bfpt, SFDP_BFPT_DWORDS_MAX);
+
+	if (fbait_ptr != 0) {
+		fbait = spi_multi_sfdp_read_dword(fbait_ptr);
+	}
+
+	quad = (spi_multi_sfdp_quad_enable(bfpt) == SPI_MULTI_SUCCESS);
+
+	if (spi_multi_sfdp_select(bfpt, fbait, quad, &sfdp_cfg) != SPI_MULTI_SUCCESS) {
+		return SPI_MULTI_ERROR;
+	}
+
+	*cfg = sfdp_cfg;
+
+	return SPI_MULTI_SUCCESS;
+}
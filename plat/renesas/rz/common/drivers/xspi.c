@@ -5,6 +5,8 @@
  */
 
 #include <stdint.h>
+#include <string.h>
+#include <common/debug.h>
 #include <lib/utils_def.h>
 #include <lib/mmio.h>
 #include <arch_helpers.h>
@@ -37,6 +39,18 @@
 
 #define XSPI_COMMAND_TIMEOUT		(100000u)
 
+#if PLAT_XSPI_DTR
+/* DTR Quad I/O Fast Read, 3-byte address */
+#define XSPI_DTR_READ_CMD			(0xED00UL)
+#define XSPI_DTR_READ_LATENCY		(PLAT_XSPI_DTR_LATENCY)
+#define XSPI_SDR_READ_CMD			(0x0300UL)
+#define XSPI_SDR_READ_LATENCY		(0UL)
+
+/* The start of the FIP (ToC header and UUIDs) is the calibration pattern */
+#define XSPI_CALIB_BASE				(RZ_SOC_SPIROM_FIP_BASE)
+#define XSPI_CALIB_SIZE				(512U)
+#endif
+
 
 typedef struct {
 	uint16_t instruction;
@@ -67,6 +81,14 @@ static const st_xspi_cmd_t cmds[] = {
 static int xspi_single_command(const st_xspi_cmd_info_t * const p_cmd_info)
 {
 	uint32_t timeout;
+#if PLAT_XSPI_DTR
+	uint32_t liocfg;
+
+	/* The commands table is 1S-1S-1S, whatever mode the reads are in */
+	liocfg = mmio_read_32(XSPI_LIOCFGCS0);
+	mmio_write_32(XSPI_LIOCFGCS0, (liocfg & ~XSPI_LIOCFGCS_PRTMD_MSK) |
+				      (XSPI_LIOCFGCS_PRTMD_1S_1S_1S << XSPI_LIOCFGCS_PRTMD_OFFSET));
+#endif
 
 	mmio_write_32(XSPI_CDCTL0, mmio_read_32(XSPI_CDCTL0) & (~XSPI_CDCTL0_TRREQ_MSK));
 
@@ -95,6 +117,10 @@ static int xspi_single_command(const st_xspi_cmd_info_t * const p_cmd_info)
 
 	mmio_write_32(XSPI_INTC, mmio_read_32(XSPI_INTC) | XSPI_INTC_CMDCMPC_MSK);
 
+#if PLAT_XSPI_DTR
+	mmio_write_32(XSPI_LIOCFGCS0, liocfg);
+#endif
+
 	return (timeout == 0u) ? XSPI_ERROR : XSPI_SUCCESS;
 }
 
@@ -230,6 +256,93 @@ int xspi_write(const uintptr_t addr, uintptr_t data, uint32_t byte_count)
 	return ret;
 }
 
+#if PLAT_XSPI_DTR
+static uint8_t xspi_calib_ref[XSPI_CALIB_SIZE];
+
+static void xspi_set_read_mode(uint32_t prtmd, uint32_t cmd, uint32_t latency,
+			       uint32_t ddrsmpex)
+{
+	uint32_t val;
+
+	val = XSPI_LIOCFGCS0_SET_VALUE & ~(XSPI_LIOCFGCS_PRTMD_MSK | XSPI_LIOCFGCS_DDRSMPEX_MSK);
+	val |= (prtmd << XSPI_LIOCFGCS_PRTMD_OFFSET) |
+	       (ddrsmpex << XSPI_LIOCFGCS_DDRSMPEX_OFFSET);
+	mmio_write_32(XSPI_LIOCFGCS0, val);
+	mmio_write_32(XSPI_CMCFG1CS0, (cmd << XSPI_CMCFG1CS_RDCMD_OFFSET) |
+				      (latency << XSPI_CMCFG1CS_RDLATE_OFFSET));
+
+	/* Nothing read with the previous settings may be reused */
+	mmio_write_32(XSPI_BMCTL1, XSPI_BMCTL1_PBUFCLR);
+	inv_dcache_range(XSPI_CALIB_BASE, XSPI_CALIB_SIZE);
+}
+
+static int xspi_dtr_check(uint32_t ddrsmpex)
+{
+	xspi_set_read_mode(XSPI_LIOCFGCS_PRTMD_1S_4D_4D, XSPI_DTR_READ_CMD,
+			   XSPI_DTR_READ_LATENCY, ddrsmpex);
+
+	return (memcmp((const void *)XSPI_CALIB_BASE, xspi_calib_ref,
+		       XSPI_CALIB_SIZE) == 0) ? XSPI_SUCCESS : XSPI_ERROR;
+}
+
+/*
+ * Switch the memory-mapped reads to 1S-4D-4D. The calibration pattern is
+ * read once in SDR mode, then every DDR sampling window extension is tried
+ * and the middle of the longest passing run is kept. If nothing passes the
+ * SDR read settings are restored.
+ */
+static int xspi_dtr_setup(void)
+{
+	uint32_t ddrsmpex;
+	uint32_t first = 0;
+	uint32_t len = 0;
+	uint32_t best_first = 0;
+	uint32_t best_len = 0;
+	uint32_t i;
+
+	xspi_set_read_mode(XSPI_LIOCFGCS_PRTMD_1S_1S_1S, XSPI_SDR_READ_CMD,
+			   XSPI_SDR_READ_LATENCY, 0);
+	memcpy(xspi_calib_ref, (const void *)XSPI_CALIB_BASE, XSPI_CALIB_SIZE);
+
+	/* An erased or constant area cannot tell good and bad sampling apart */
+	for (i = 1; i < XSPI_CALIB_SIZE; i++) {
+		if (xspi_calib_ref[i] != xspi_calib_ref[0]) {
+			break;
+		}
+	}
+
+	if (i < XSPI_CALIB_SIZE) {
+		for (ddrsmpex = 0; ddrsmpex <= XSPI_LIOCFGCS_DDRSMPEX_MAX; ddrsmpex++) {
+			if (xspi_dtr_check(ddrsmpex) != XSPI_SUCCESS) {
+				len = 0;
+				continue;
+			}
+			if (len == 0) {
+				first = ddrsmpex;
+			}
+			len++;
+			if (len > best_len) {
+				best_first = first;
+				best_len = len;
+			}
+		}
+	}
+
+	if ((best_len != 0) &&
+	    (xspi_dtr_check(best_first + (best_len / 2U)) == XSPI_SUCCESS)) {
+		NOTICE("BL2: xSPI 1S-4D-4D read, sampling window %u-%u\n",
+		       best_first, best_first + best_len - 1U);
+		return XSPI_SUCCESS;
+	}
+
+	xspi_set_read_mode(XSPI_LIOCFGCS_PRTMD_1S_1S_1S, XSPI_SDR_READ_CMD,
+			   XSPI_SDR_READ_LATENCY, 0);
+	NOTICE("BL2: xSPI DTR calibration failed, using 1S-1S-1S read\n");
+
+	return XSPI_ERROR;
+}
+#endif /* PLAT_XSPI_DTR */
+
 int xspi_setup(void)
 {
 	int ret;
@@ -247,5 +360,10 @@ int xspi_setup(void)
 	if (ret == XSPI_SUCCESS)
 		ret = xspi_read_identification();
 
+#if PLAT_XSPI_DTR
+	if ((ret != DEVICE_ID_BAD) && (ret != DEVICE_ID_ERROR) && (ret != XSPI_ERROR))
+		xspi_dtr_setup();
+#endif
+
 	return ret;
 }
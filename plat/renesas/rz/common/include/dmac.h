@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DMAC_H
+#define DMAC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DMAC_SUCCESS				(0)
+#define DMAC_ERROR					(-1)
+
+/* Source and destination must share this alignment */
+#define DMAC_ALIGN					(8U)
+
+int32_t dmac_init(void);
+int32_t dmac_copy(uintptr_t dst, uintptr_t src, size_t len);
+int32_t dmac_copy_start(uintptr_t dst, uintptr_t src, size_t len);
+int32_t dmac_copy_wait(void);
+
+#endif /* DMAC_H */
@@ -37,10 +37,23 @@
 #define SPI_MULTI_SUCCESS	(0)
 #define SPI_MULTI_ERROR		(-1)
 
+/* External address space read settings */
+typedef struct {
+	uint32_t drcmr;
+	uint32_t drear;
+	uint32_t dropr;
+	uint32_t drenr;
+	uint32_t drdmcr;
+	uint32_t addr_wides;
+	uint32_t dq_wides;
+	uint32_t dummy;
+} spi_multi_read_cfg_t;
+
 int spi_multi_setup(void);
 void spi_multi_setup_device(void);
 void spi_multi_timing_set(void);
 uint8_t spi_multi_cmd_read(uint8_t command);
 void spi_multi_cmd_write(uint8_t command, uint8_t size, uint32_t data);
+int spi_multi_sfdp_setup(spi_multi_read_cfg_t *cfg);
 
 #endif	/* _SPI_MULTI_H_ */
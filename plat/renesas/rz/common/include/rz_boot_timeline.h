@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __RZ_BOOT_TIMELINE_H__
+#define __RZ_BOOT_TIMELINE_H__
+
+/* PMF service id of the boot timeline (0 and 1 are PSCI stats and RT instr) */
+#define RZ_BOOT_TL_SVC_ID			2
+
+/* Boot stages; each one owns a start and an end timestamp */
+#define RZ_BOOT_TL_PFC				0
+#define RZ_BOOT_TL_CPG				1
+#define RZ_BOOT_TL_DDR				2
+#define RZ_BOOT_TL_IO_SETUP			3
+#define RZ_BOOT_TL_BL31_LOAD		4
+#define RZ_BOOT_TL_BL31_AUTH		5
+#define RZ_BOOT_TL_BL32_LOAD		6
+#define RZ_BOOT_TL_BL32_AUTH		7
+#define RZ_BOOT_TL_BL33_LOAD		8
+#define RZ_BOOT_TL_BL33_AUTH		9
+#define RZ_BOOT_TL_BL31_SETUP		10
+#define RZ_BOOT_TL_STAGES			11
+
+#define RZ_BOOT_TL_START(_stage)	((_stage) * 2)
+#define RZ_BOOT_TL_END(_stage)		(((_stage) * 2) + 1)
+#define RZ_BOOT_TL_TOTAL_IDS		(RZ_BOOT_TL_STAGES * 2)
+
+/* Per-image phases, relative to the image's LOAD stage */
+#define RZ_BOOT_TL_IMAGE_LOAD		0
+#define RZ_BOOT_TL_IMAGE_AUTH		1
+
+#ifndef __ASSEMBLER__
+
+#include <stdbool.h>
+
+#if PLAT_BOOT_TIMELINE
+
+void rz_boot_timeline_capture(unsigned int tid);
+void rz_boot_timeline_image(unsigned int image_id, unsigned int phase,
+			    bool end);
+#if IMAGE_BL2
+void rz_boot_timeline_report(unsigned long long *out);
+#endif
+#if IMAGE_BL31
+void rz_boot_timeline_restore(const unsigned long long *in);
+int rz_boot_timeline_get(unsigned int stage_tid, unsigned long long *ts);
+#endif
+
+#define RZ_BOOT_TL_STAGE_START(_stage)					\
+	rz_boot_timeline_capture(RZ_BOOT_TL_START(_stage))
+#define RZ_BOOT_TL_STAGE_END(_stage)					\
+	rz_boot_timeline_capture(RZ_BOOT_TL_END(_stage))
+#define RZ_BOOT_TL_IMAGE_START(_image_id, _phase)			\
+	rz_boot_timeline_image((_image_id), (_phase), false)
+#define RZ_BOOT_TL_IMAGE_END(_image_id, _phase)				\
+	rz_boot_timeline_image((_image_id), (_phase), true)
+
+#else
+
+#define RZ_BOOT_TL_STAGE_START(_stage)
+#define RZ_BOOT_TL_STAGE_END(_stage)
+#define RZ_BOOT_TL_IMAGE_START(_image_id, _phase)
+#define RZ_BOOT_TL_IMAGE_END(_image_id, _phase)
+
+#endif /* PLAT_BOOT_TIMELINE */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* __RZ_BOOT_TIMELINE_H__ */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __RZ_LOG_RING_H__
+#define __RZ_LOG_RING_H__
+
+/* "RLOG" */
+#define RZ_LOG_RING_MAGIC		U(0x474F4C52)
+
+/* Set once data[] has filled and the oldest byte is at 'head' */
+#define RZ_LOG_RING_WRAPPED		U(0x1)
+
+#ifndef __ASSEMBLER__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <drivers/console.h>
+
+/*
+ * Firmware log ring at RZ_LOG_RING_BASE, shared by BL2 and BL31 and read by
+ * the OS from non-secure memory. Without RZ_LOG_RING_WRAPPED the log is
+ * data[0] to data[head - 1], with it the log starts at data[head] and wraps at
+ * 'size'. 'pending' counts the bytes at the end of the log not yet sent to the
+ * UART.
+ */
+typedef struct rz_log_ring {
+	uint32_t magic;
+	uint32_t size;
+	uint32_t head;
+	uint32_t flags;
+	uint32_t pending;
+	uint32_t reserved[3];
+	uint8_t data[];
+} rz_log_ring_t;
+
+/*
+ * Registers the ring at 'base' as the boot console, passing its content on to
+ * 'uart' when the console is flushed, on panic and ahead of crash output. With
+ * 'fresh' the ring is emptied, otherwise a valid ring left by the previous
+ * stage is kept.
+ */
+void rz_log_ring_register(console_t *uart, uintptr_t base, bool fresh);
+
+/* Moves the registered ring, with the log so far, to a new ring at 'base' */
+void rz_log_ring_move(uintptr_t base);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* __RZ_LOG_RING_H__ */
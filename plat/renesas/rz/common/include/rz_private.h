@@ -9,6 +9,7 @@
 
 #include <common/bl_common.h>
 #include <platform_def.h>
+#include <rz_boot_timeline.h>
 
 /* plat_helper.S */
 void plat_invalidate_icache(void);
@@ -28,6 +29,10 @@ void plat_tzc400_setup(uintptr_t tzc_base);
 /* plat_storage.c */
 void rz_io_setup(void);
 
+/* plat_image_load.c */
+void rz_image_decompress_prepare(unsigned int image_id);
+int rz_image_decompress(unsigned int image_id);
+
 /* plat_ddr_setup.c  */
 void plat_ddr_setup(void);
 
@@ -43,6 +48,9 @@ typedef struct bl2_to_bl31_params_mem {
 	boot_kind_t boot_kind;
 	entry_point_info_t bl32_ep_info;
 	entry_point_info_t bl33_ep_info;
+#if PLAT_BOOT_TIMELINE
+	unsigned long long boot_timeline[RZ_BOOT_TL_TOTAL_IDS];
+#endif
 } bl2_to_bl31_params_mem_t;
 
 #endif	/* __RZ_PRIVATE_H__ */
@@ -28,4 +28,10 @@
 /* Function ID to set PCIe register values */
 #define RZ_SIP_SVC_SET_SYSPCIE		U(0x82000021)
 
+/* Function ID to get a boot timeline timestamp (PLAT_BOOT_TIMELINE) */
+#define RZ_SIP_SVC_GET_BOOT_TIMESTAMP	U(0x82000030)
+
+/* Function ID to get the base and size of the firmware log ring (PLAT_LOG_RING) */
+#define RZ_SIP_SVC_GET_LOG_RING		U(0x82000031)
+
 #endif /* __RZ_SIP_SVC_H__ */
@@ -25,6 +25,7 @@
 #define RZG2L_TZC_DDR_BASE			(0x11070000)
 #define RZG2L_DDR_PHY_BASE			(0x11400000)
 #define RZG2L_DDR_MEMC_BASE			(0x11410000)
+#define RZG2L_DMAC_BASE				(0x11820000)
 #define RZG2L_OTP_BASE				(0x11860000)
 #define RZG2L_GIC_BASE				(0x11900000)
 #define RZG2L_SD0_BASE				(0x11C00000)
@@ -97,6 +98,8 @@
 #define MMC0_SD_BASE				RZG2L_SD0_BASE
 #define MMC1_SD_BASE				RZG2L_SD1_BASE
 
+#define RZ_SOC_DMAC_BASE			RZG2L_DMAC_BASE
+
 #define RZ_SOC_SYSC_BASE_DEVID		(RZG2L_SYSC_BASE + 0x0A04)
 #define RZ_SOC_OTP_BASE_DEVID		(RZG2L_OTP_BASE + 0x1178)
 #define RZ_SOC_OTP_BASE_CHIPID		(RZG2L_OTP_BASE + 0x1140)
@@ -17,6 +17,7 @@
 #define XSPI_CMCFG2CS0				(XSPI_BASE + 0x018UL)
 #define XSPI_LIOCFGCS0				(XSPI_BASE + 0x050UL)
 #define XSPI_BMCTL0					(XSPI_BASE + 0x060UL)
+#define XSPI_BMCTL1					(XSPI_BASE + 0x064UL)
 #define XSPI_CSSCTL					(XSPI_BASE + 0x06CUL)
 #define XSPI_CDCTL0					(XSPI_BASE + 0x070UL)
 #define XSPI_CDTBUF0				(XSPI_BASE + 0x080UL)
@@ -47,4 +48,18 @@
 #define XSPI_BMCTL0_CH0CS0ACC_READ	(0x1)
 #define XSPI_BMCTL0_CH0CS0ACC_WRITE	(0x2)
 
+#define XSPI_BMCTL1_PBUFCLR			(0x1U << 10U)
+
+/* LIOCFGCSn: PRTMD is {data DDR, data width, addr DDR, addr width, cmd DDR, cmd width} */
+#define XSPI_LIOCFGCS_PRTMD_OFFSET	(0U)
+#define XSPI_LIOCFGCS_PRTMD_MSK		(0x3FFU << XSPI_LIOCFGCS_PRTMD_OFFSET)
+#define XSPI_LIOCFGCS_PRTMD_1S_1S_1S	(0x000U)
+#define XSPI_LIOCFGCS_PRTMD_1S_4D_4D	(0x1B0U)
+#define XSPI_LIOCFGCS_DDRSMPEX_OFFSET	(28U)
+#define XSPI_LIOCFGCS_DDRSMPEX_MSK	(0xFU << XSPI_LIOCFGCS_DDRSMPEX_OFFSET)
+#define XSPI_LIOCFGCS_DDRSMPEX_MAX	(0xFU)
+
+#define XSPI_CMCFG1CS_RDCMD_OFFSET	(0U)
+#define XSPI_CMCFG1CS_RDLATE_OFFSET	(16U)
+
 #endif /* _XSPI_REG_H_ */
@@ -4,10 +4,21 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <common/desc_image_load.h>
+#include <common/image_decompress.h>
 #include <arch_helpers.h>
 #include <platform_def.h>
 #include <rz_soc_def.h>
+#include <rz_private.h>
+#if PLAT_BL2_WORKERS
+#include <bl2_workers.h>
+#endif
+#if PLAT_IMAGE_GZIP
+#include <tf_gunzip.h>
+#elif (PLAT_BL32_COMPRESS || PLAT_BL33_COMPRESS)
+#include <tf_unlz4.h>
+#endif
 
 
 bl_load_info_t *plat_get_bl_image_load_info(void)
@@ -28,3 +39,73 @@ void plat_flush_next_bl_params(void)
 #endif
 }
 
+#if (PLAT_BL32_COMPRESS || PLAT_BL33_COMPRESS)
+static bool rz_image_is_compressed(unsigned int image_id)
+{
+	return ((image_id == BL32_IMAGE_ID) && (PLAT_BL32_COMPRESS != 0)) ||
+		((image_id == BL33_IMAGE_ID) && (PLAT_BL33_COMPRESS != 0));
+}
+
+void bl2_plat_preload_setup(void)
+{
+#if PLAT_IMAGE_STREAM
+	image_decompress_stream_init(PLAT_DECOMP_BUF_BASE, PLAT_DECOMP_WINDOW_SIZE,
+				     PLAT_DECOMP_BUF_BASE + PLAT_DECOMP_WINDOW_SIZE,
+				     PLAT_DECOMP_WORK_SIZE,
+#if PLAT_IMAGE_GZIP
+				     gunzip_stream);
+#else
+				     unlz4_stream);
+#endif
+#elif PLAT_IMAGE_GZIP
+	image_decompress_init(PLAT_DECOMP_BUF_BASE, PLAT_DECOMP_BUF_SIZE, gunzip);
+#else
+	image_decompress_init(PLAT_DECOMP_BUF_BASE, PLAT_DECOMP_BUF_SIZE, unlz4);
+#if PLAT_BL2_WORKERS
+	unlz4_set_jobs(bl2_workers_submit, bl2_workers_wait, bl2_workers_count());
+#endif
+#endif
+}
+#endif /* PLAT_BL32_COMPRESS || PLAT_BL33_COMPRESS */
+
+/*
+ * A compressed BL32/BL33 is read into the scratch buffer at
+ * PLAT_DECOMP_BUF_BASE, authenticated there and then decompressed to its
+ * load address by rz_image_decompress() from the post image load hook.
+ *
+ * With PLAT_IMAGE_STREAM the generic load is skipped instead and the post
+ * image load hook reads the image through the decompressor, a window at a
+ * time, straight to its load address. Pending pipelined loads have completed
+ * by then, so this is safe with BL2_PIPELINED_LOAD.
+ */
+void rz_image_decompress_prepare(unsigned int image_id)
+{
+#if (PLAT_BL32_COMPRESS || PLAT_BL33_COMPRESS)
+	image_info_t *info = &get_bl_mem_params_node(image_id)->image_info;
+
+	if (!rz_image_is_compressed(image_id))
+		return;
+#if PLAT_IMAGE_STREAM
+	info->h.attr |= IMAGE_ATTRIB_SKIP_LOADING;
+#else
+	image_decompress_prepare(info);
+#endif
+#endif
+}
+
+int rz_image_decompress(unsigned int image_id)
+{
+#if (PLAT_BL32_COMPRESS || PLAT_BL33_COMPRESS)
+	image_info_t *info = &get_bl_mem_params_node(image_id)->image_info;
+
+	if (!rz_image_is_compressed(image_id))
+		return 0;
+#if PLAT_IMAGE_STREAM
+	return image_decompress_stream(image_id, info);
+#else
+	return image_decompress(info);
+#endif
+#endif
+
+	return 0;
+}
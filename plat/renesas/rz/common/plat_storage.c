@@ -13,12 +13,15 @@
 #include <io_common.h>
 #include <io_emmcdrv.h>
 #include <io_sddrv.h>
+#if PLAT_SPI_DMA_ENABLE
+#include <io_spidrv.h>
+#endif /* PLAT_SPI_DMA_ENABLE */
 #include <lib/mmio.h>
 #include <tools_share/firmware_image_package.h>
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 #include <plat_tbbr_img_def.h>
 #include <io_xspidrv.h>
-#endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#endif /* (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H */
 
 #include <rz_soc_def.h>
 #include <sys.h>
@@ -38,7 +41,7 @@ static uintptr_t memdrv_dev_handle;
 static uintptr_t emmcdrv_dev_handle;
 #endif /* BOOT_MODE_eMMC_NOT_SUPPORTED */
 static uintptr_t sddrv_dev_handle;
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 static uintptr_t xspidrv_dev_handle;
 #endif
 
@@ -106,15 +109,22 @@ static const io_block_spec_t spirom_ddr_cfg_spec = {
 };
 #endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
 
+#if (PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H)
+static const io_block_spec_t spirom_ddr_train_spec = {
+	.offset = RZ_SOC_SPIROM_DDR_TRAIN_BASE,
+	.length = RZ_SOC_SPIROM_DDR_TRAIN_SIZE,
+};
+#endif /* PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H */
+
 #ifndef BOOT_MODE_eMMC_NOT_SUPPORTED
 static int32_t open_emmcdrv(const uintptr_t spec);
 #endif /* BOOT_MODE_eMMC_NOT_SUPPORTED */
 static int32_t open_memmap(const uintptr_t spec);
 static int32_t open_fipdrv(const uintptr_t spec);
 static int32_t open_sddrv(const uintptr_t spec);
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 static int32_t open_xspidrv(const uintptr_t spec);
-#endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#endif /* (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H */
 
 struct plat_io_policy {
 	uintptr_t *dev_handle;
@@ -150,6 +160,14 @@ static const struct plat_io_policy spirom_ddr_config_policy = {
 };
 #endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
 
+#if (PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H)
+static const struct plat_io_policy spirom_ddr_train_policy = {
+	&xspidrv_dev_handle,
+	(uintptr_t) &spirom_ddr_train_spec,
+	&open_xspidrv
+};
+#endif /* PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H */
+
 static struct plat_io_policy policies[MAX_NUMBER_IDS] = {
 	/* FIP_IMAGE_ID structure is added to this array on a bootmode basis */
 
@@ -233,7 +251,7 @@ static int32_t open_sddrv(const uintptr_t spec)
 	return io_dev_init(sddrv_dev_handle, 0);
 }
 
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 static int32_t open_xspidrv(const uintptr_t spec)
 {
 	uintptr_t handle;
@@ -249,7 +267,7 @@ static int32_t open_xspidrv(const uintptr_t spec)
 
 	return result;
 }
-#endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#endif /* (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H */
 
 static void update_dev_policies(uint16_t boot_mode)
 {
@@ -260,6 +278,9 @@ static void update_dev_policies(uint16_t boot_mode)
 #if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
 		policies[V2H_DDR_CONFIG_ID] = spirom_ddr_config_policy;
 #endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#if (PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H)
+		policies[V2H_DDR_TRAIN_ID] = spirom_ddr_train_policy;
+#endif /* PLAT_DDR_FAST_BOOT && PLAT_SOC_RZV2H */
 		break;
 #ifndef BOOT_MODE_eMMC_NOT_SUPPORTED
 	case SYS_BOOT_MODE_EMMC_1_8:
@@ -283,9 +304,9 @@ void rz_io_setup(void)
 #endif /* BOOT_MODE_eMMC_NOT_SUPPORTED */
 	const io_dev_connector_t *rzsoc;
 	const io_dev_connector_t *sd;
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 	const io_dev_connector_t *xspi;
-#endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#endif /* (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H */
 	boot_mode_t boot_mode;
 
 	boot_mode = sys_get_boot_mode();
@@ -303,13 +324,17 @@ void rz_io_setup(void)
 #else
 		xspi_setup();
 #endif /* PLAT_SOC_RZG2L */
+#if PLAT_SPI_DMA_ENABLE
+		register_io_dev_spidrv(&memmap);
+#else
 		register_io_dev_memmap(&memmap);
+#endif /* PLAT_SPI_DMA_ENABLE */
 		io_dev_open(memmap, 0, &memdrv_dev_handle);
 
-#if (PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H)
+#if ((PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H)
 		register_io_dev_xspidrv(&xspi);
 		io_dev_open(xspi, 0, &xspidrv_dev_handle);
-#endif /* PLAT_SYSTEM_SUSPEND && PLAT_SOC_RZV2H */
+#endif /* (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT) && PLAT_SOC_RZV2H */
 #ifndef BOOT_MODE_eMMC_NOT_SUPPORTED
 	} else if  (boot_mode == SYS_BOOT_MODE_EMMC_1_8 ||
 				boot_mode == SYS_BOOT_MODE_EMMC_3_3) {
@@ -355,3 +380,21 @@ int plat_get_image_source(unsigned int image_id, uintptr_t *dev_handle,
 	return 0;
 }
 
+
+#if (BL2_PIPELINED_LOAD && PLAT_SPI_DMA_ENABLE)
+/*
+ * Only the SPI boot path reads in the background; eMMC and SD reads complete
+ * before returning, so arming has no effect there.
+ */
+void bl2_plat_start_async_load(unsigned int image_id)
+{
+	spidrv_arm_async_read(image_id);
+}
+
+int bl2_plat_wait_async_load(unsigned int image_id)
+{
+	spidrv_wait_async_read(image_id);
+
+	return 0;
+}
+#endif /* BL2_PIPELINED_LOAD && PLAT_SPI_DMA_ENABLE */
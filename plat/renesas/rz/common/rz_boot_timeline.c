@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <arch_helpers.h>
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <drivers/console.h>
+#include <lib/pmf/pmf.h>
+#include <plat/common/platform.h>
+#include <rz_boot_timeline.h>
+
+/*
+ * Boot-stage timestamps, in system counter ticks. BL2 captures them into its
+ * own PMF store and hands them to BL31 through bl2_to_bl31_params_mem_t;
+ * BL31 restores them, appends its own and serves them over SiP. All stages
+ * run on the boot core, so only its slot of the per-CPU store is used.
+ */
+PMF_REGISTER_SERVICE(rz_boot_tl, RZ_BOOT_TL_SVC_ID, RZ_BOOT_TL_TOTAL_IDS,
+		     PMF_STORE_ENABLE)
+
+#define RZ_BOOT_TL_TID(_id)		\
+	((RZ_BOOT_TL_SVC_ID << PMF_SVC_ID_SHIFT) | (_id))
+
+static unsigned int boot_core_pos;
+
+void rz_boot_timeline_capture(unsigned int tid)
+{
+	boot_core_pos = plat_my_core_pos();
+	PMF_CAPTURE_TIMESTAMP(rz_boot_tl, RZ_BOOT_TL_TID(tid),
+			      PMF_NO_CACHE_MAINT);
+}
+
+void rz_boot_timeline_image(unsigned int image_id, unsigned int phase,
+			    bool end)
+{
+	unsigned int stage;
+
+	switch (image_id) {
+	case BL31_IMAGE_ID:
+		stage = RZ_BOOT_TL_BL31_LOAD;
+		break;
+	case BL32_IMAGE_ID:
+		stage = RZ_BOOT_TL_BL32_LOAD;
+		break;
+	case BL33_IMAGE_ID:
+		stage = RZ_BOOT_TL_BL33_LOAD;
+		break;
+	default:
+		/* Certificates and other images are not tracked */
+		return;
+	}
+
+	stage += phase;
+	rz_boot_timeline_capture(end ? RZ_BOOT_TL_END(stage) :
+				 RZ_BOOT_TL_START(stage));
+}
+
+static unsigned long long rz_boot_timeline_read(unsigned int tid)
+{
+	unsigned long long ts;
+
+	PMF_GET_TIMESTAMP_BY_INDEX(rz_boot_tl, RZ_BOOT_TL_TID(tid),
+				   boot_core_pos, PMF_NO_CACHE_MAINT, ts);
+	return ts;
+}
+
+#if IMAGE_BL2
+static const char *const stage_names[RZ_BOOT_TL_STAGES] = {
+	[RZ_BOOT_TL_PFC]		= "PFC setup",
+	[RZ_BOOT_TL_CPG]		= "CPG setup",
+	[RZ_BOOT_TL_DDR]		= "DDR setup",
+	[RZ_BOOT_TL_IO_SETUP]		= "IO setup",
+	[RZ_BOOT_TL_BL31_LOAD]		= "BL31 load",
+	[RZ_BOOT_TL_BL31_AUTH]		= "BL31 auth",
+	[RZ_BOOT_TL_BL32_LOAD]		= "BL32 load",
+	[RZ_BOOT_TL_BL32_AUTH]		= "BL32 auth",
+	[RZ_BOOT_TL_BL33_LOAD]		= "BL33 load",
+	[RZ_BOOT_TL_BL33_AUTH]		= "BL33 auth",
+};
+
+static unsigned long long ticks_to_us(unsigned long long ticks)
+{
+	return (ticks * 1000000ULL) / read_cntfrq_el0();
+}
+
+static unsigned long long rz_boot_timeline_span(unsigned int stage)
+{
+	unsigned long long start = rz_boot_timeline_read(RZ_BOOT_TL_START(stage));
+	unsigned long long end = rz_boot_timeline_read(RZ_BOOT_TL_END(stage));
+
+	if ((start == 0ULL) || (end < start))
+		return 0ULL;
+
+	return end - start;
+}
+
+/*
+ * Print the BL2 part of the timeline and copy all of it to 'out', which must
+ * hold RZ_BOOT_TL_TOTAL_IDS entries. IO time of an image is its load time
+ * less the time spent authenticating it.
+ */
+void rz_boot_timeline_report(unsigned long long *out)
+{
+	unsigned long long span, auth;
+	unsigned int i;
+
+	NOTICE("BL2: Boot timeline\n");
+	for (i = 0U; i < RZ_BOOT_TL_STAGES; i++) {
+		if (stage_names[i] == NULL)
+			continue;
+
+		span = rz_boot_timeline_span(i);
+		if (span == 0ULL)
+			continue;
+
+		if ((i == RZ_BOOT_TL_BL31_LOAD) || (i == RZ_BOOT_TL_BL32_LOAD) ||
+		    (i == RZ_BOOT_TL_BL33_LOAD)) {
+			auth = rz_boot_timeline_span(i + RZ_BOOT_TL_IMAGE_AUTH);
+			NOTICE("BL2:   %s: %llu us (io %llu us)\n", stage_names[i],
+			       ticks_to_us(span), ticks_to_us(span - auth));
+		} else {
+			NOTICE("BL2:   %s: %llu us\n", stage_names[i],
+			       ticks_to_us(span));
+		}
+	}
+
+	for (i = 0U; i < RZ_BOOT_TL_TOTAL_IDS; i++)
+		out[i] = rz_boot_timeline_read(i);
+}
+#endif /* IMAGE_BL2 */
+
+#if IMAGE_BL31
+void rz_boot_timeline_restore(const unsigned long long *in)
+{
+	unsigned int i;
+
+	boot_core_pos = plat_my_core_pos();
+	for (i = 0U; i < RZ_BOOT_TL_TOTAL_IDS; i++)
+		PMF_WRITE_TIMESTAMP(rz_boot_tl, RZ_BOOT_TL_TID(i),
+				    PMF_NO_CACHE_MAINT, in[i]);
+}
+
+int rz_boot_timeline_get(unsigned int stage_tid, unsigned long long *ts)
+{
+	if (stage_tid >= RZ_BOOT_TL_TOTAL_IDS)
+		return -EINVAL;
+
+	*ts = rz_boot_timeline_read(stage_tid);
+	return 0;
+}
+
+/* Closes the BL31 stage just before the cold boot exits to the next image */
+void bl31_plat_runtime_setup(void)
+{
+	console_switch_state(CONSOLE_FLAG_RUNTIME);
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_BL31_SETUP);
+}
+#endif /* IMAGE_BL31 */
@@ -16,10 +16,48 @@ TRUSTED_BOARD_BOOT				:= 0
 PROTECTED_CHIPID				:= 1
 DEBUG_FPGA						:= 0
 PLAT_EMMC_WRITE_ENABLE			:= 0
+PLAT_EMMC_DMA_ENABLE			:= 1
+# eMMC bus mode: 0 = HS52, 200 = HS200, 400 = HS400 (needs 1.8V VCCQ)
+PLAT_EMMC_BUS_MODE				:= 0
+# SD bus mode: 0 = DS, 1 = HS, 50 = SDR50, 104 = SDR104 (needs 1.8V signalling)
+PLAT_SD_BUS_MODE				:= 0
+# Derive the SPI flash read command from its SFDP tables (falls back to SPI_FLASH)
+PLAT_SPI_MULTI_SFDP				:= 1
+# Copy large FIP reads out of the SPI window with the DMAC (falls back to the CPU)
+PLAT_SPI_DMA_ENABLE				:= 1
+# eMMC/SD sector cache: number of lines and sectors read ahead per line
+PLAT_SECTOR_CACHE_ENTRIES		:= 4
+PLAT_SECTOR_CACHE_READ_AHEAD	:= 4
+# Record a PMF timeline of the boot stages, print it at the end of BL2 and
+# serve it from BL31 over RZ_SIP_SVC_GET_BOOT_TIMESTAMP
+PLAT_BOOT_TIMELINE				:= 0
+# Read BL32/BL33 compressed from the FIP into a scratch buffer in DRAM and
+# decompress them to their load address (PLAT_IMAGE_COMPRESSION: lz4 or gzip)
+PLAT_BL32_COMPRESS				:= 0
+PLAT_BL33_COMPRESS				:= 0
+PLAT_IMAGE_COMPRESSION			:= lz4
+# Decompress them while they are read, through a small window instead of the
+# scratch buffer (not authenticated, so not with TRUSTED_BOARD_BOOT)
+PLAT_IMAGE_STREAM				:= 0
+# DDR VREF training: step of the coarse search before the fine one around
+# its best values (1 = train every VREF code in the range)
+PLAT_DDR_VREF_COARSE_STEP		:= 4
 
 $(eval $(call add_define,PLAT_SOC_RZG2L))
 $(eval $(call add_define,PROTECTED_CHIPID))
 $(eval $(call add_define,DEBUG_FPGA))
+$(eval $(call add_define,PLAT_EMMC_DMA_ENABLE))
+$(eval $(call add_define,PLAT_EMMC_BUS_MODE))
+$(eval $(call add_define,PLAT_SD_BUS_MODE))
+$(eval $(call add_define,PLAT_SPI_MULTI_SFDP))
+$(eval $(call add_define,PLAT_SPI_DMA_ENABLE))
+$(eval $(call add_define,PLAT_SECTOR_CACHE_ENTRIES))
+$(eval $(call add_define,PLAT_SECTOR_CACHE_READ_AHEAD))
+$(eval $(call add_define,PLAT_BOOT_TIMELINE))
+$(eval $(call add_define,PLAT_DDR_VREF_COARSE_STEP))
+$(eval $(call add_define,PLAT_BL32_COMPRESS))
+$(eval $(call add_define,PLAT_BL33_COMPRESS))
+$(eval $(call add_define,PLAT_IMAGE_STREAM))
 
 WA_RZG2L_GIC64BIT				:= 1
 $(eval $(call add_define,WA_RZG2L_GIC64BIT))
@@ -60,6 +98,15 @@ EMMC_SOURCES			:=	plat/renesas/rz/common/drivers/emmc/emmc_interrupt.c	\
 SPI_MULTI_SOURCE 		:=	plat/renesas/rz/common/drivers/spi_multi/spi_multi.c	\
 							plat/renesas/rz/common/drivers/spi_multi/${SPI_FLASH}/spi_multi_device.c
 
+ifeq (${PLAT_SPI_MULTI_SFDP},1)
+SPI_MULTI_SOURCE		+=	plat/renesas/rz/common/drivers/spi_multi/spi_multi_sfdp.c
+endif
+
+ifeq (${PLAT_SPI_DMA_ENABLE},1)
+SPI_MULTI_SOURCE		+=	plat/renesas/rz/common/drivers/dmac.c					\
+							plat/renesas/rz/common/drivers/io/io_spidrv.c
+endif
+
 SD_SOURCES				:=	plat/renesas/rz/common/drivers/sd/sd_init.c				\
 							plat/renesas/rz/common/drivers/sd/sd_mount.c			\
 							plat/renesas/rz/common/drivers/sd/sd_util.c				\
@@ -94,6 +141,7 @@ BL2_SOURCES				+=	common/desc_image_load.c								\
 							drivers/io/io_fip.c										\
 							plat/renesas/rz/common/drivers/io/io_emmcdrv.c			\
 							plat/renesas/rz/common/drivers/io/io_sddrv.c			\
+							plat/renesas/rz/common/drivers/io/io_sector_cache.c		\
 							plat/renesas/rz/common/bl2_plat_setup.c					\
 							plat/renesas/rz/common/bl2_plat_mem_params_desc.c		\
 							plat/renesas/rz/common/plat_image_load.c				\
@@ -117,6 +165,43 @@ BL31_SOURCES			+=	plat/common/plat_gicv3.c								\
 							plat/renesas/rz/common/rz_sip_svc.c						\
 							${GICV3_SOURCES}
 
+ifeq (${PLAT_BOOT_TIMELINE},1)
+ENABLE_PMF				:=	1
+BL2_SOURCES				+=	lib/pmf/pmf_main.c										\
+							plat/renesas/rz/common/rz_boot_timeline.c
+BL31_SOURCES			+=	plat/renesas/rz/common/rz_boot_timeline.c
+endif
+
+PLAT_IMAGE_GZIP			:=	0
+ifneq ($(filter 1,${PLAT_BL32_COMPRESS} ${PLAT_BL33_COMPRESS}),)
+ifeq (${PLAT_BL32_COMPRESS}${PLAT_BL33_COMPRESS}${BL2_PIPELINED_LOAD}${PLAT_IMAGE_STREAM},1110)
+$(error PLAT_BL32_COMPRESS and PLAT_BL33_COMPRESS share one scratch buffer, which needs BL2_PIPELINED_LOAD=0)
+endif
+ifeq (${PLAT_IMAGE_STREAM}${TRUSTED_BOARD_BOOT},11)
+$(error PLAT_IMAGE_STREAM does not authenticate the images, which TRUSTED_BOARD_BOOT needs)
+endif
+BL2_SOURCES				+=	common/image_decompress.c
+ifeq (${PLAT_IMAGE_COMPRESSION},lz4)
+include lib/lz4/lz4.mk
+BL2_SOURCES				+=	${LZ4_SOURCES}
+PLAT_IMAGE_FILTER		:=	LZ4
+else ifeq (${PLAT_IMAGE_COMPRESSION},gzip)
+include lib/zlib/zlib.mk
+BL2_SOURCES				+=	${ZLIB_SOURCES}
+PLAT_IMAGE_FILTER		:=	GZIP
+PLAT_IMAGE_GZIP			:=	1
+else
+$(error Unknown PLAT_IMAGE_COMPRESSION ${PLAT_IMAGE_COMPRESSION})
+endif
+ifeq (${PLAT_BL32_COMPRESS},1)
+BL32_PRE_TOOL_FILTER	:=	${PLAT_IMAGE_FILTER}
+endif
+ifeq (${PLAT_BL33_COMPRESS},1)
+BL33_PRE_TOOL_FILTER	:=	${PLAT_IMAGE_FILTER}
+endif
+endif
+$(eval $(call add_define,PLAT_IMAGE_GZIP))
+
 ifneq (${TRUSTED_BOARD_BOOT},0)
 
 	# Include common TBB sources
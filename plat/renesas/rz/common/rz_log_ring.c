@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/console.h>
+#include <lib/utils_def.h>
+#include <platform_def.h>
+#include <rz_log_ring.h>
+#include <rz_soc_def.h>
+
+/*
+ * Console that only stores characters in the log ring. The UART at 115200
+ * baud takes close to 100 us a character, so it is fed from the ring at the
+ * flush points (console_flush() before each image exit) and on panic instead
+ * of on every print. Every completed line is cleaned to memory, so the next
+ * stage and the OS always see the log up to its last line. Crash output goes
+ * to the UART as it comes, but only once the log still in the ring is out.
+ */
+static console_t *log_ring_uart;
+
+/* Value of 'head' when the ring was last cleaned to memory */
+static uint32_t log_ring_clean;
+
+static void log_ring_sync(rz_log_ring_t *ring)
+{
+	uint32_t from = log_ring_clean;
+
+	if (ring->head < from) {
+		flush_dcache_range((uintptr_t)&ring->data[from], ring->size - from);
+		from = 0U;
+	}
+	flush_dcache_range((uintptr_t)&ring->data[from], ring->head - from);
+	flush_dcache_range((uintptr_t)ring, sizeof(*ring));
+
+	log_ring_clean = ring->head;
+}
+
+static void log_ring_store(rz_log_ring_t *ring, uint8_t c)
+{
+	ring->data[ring->head] = c;
+	if (++ring->head == ring->size) {
+		ring->head = 0U;
+		ring->flags |= RZ_LOG_RING_WRAPPED;
+	}
+}
+
+static int log_ring_putc(int c, console_t *console)
+{
+	rz_log_ring_t *ring = (rz_log_ring_t *)console->base;
+
+	log_ring_store(ring, (uint8_t)c);
+
+	/* Unsent bytes that were overwritten are lost to the UART */
+	if (ring->pending < ring->size)
+		ring->pending++;
+
+	if (c == '\n')
+		log_ring_sync(ring);
+
+	return c;
+}
+
+static void log_ring_drain(rz_log_ring_t *ring)
+{
+	uint32_t pos = ring->head + ring->size - ring->pending;
+
+	if (pos >= ring->size)
+		pos -= ring->size;
+
+	while (ring->pending != 0U) {
+		(void)log_ring_uart->putc(ring->data[pos], log_ring_uart);
+		if (++pos == ring->size)
+			pos = 0U;
+		ring->pending--;
+	}
+
+	log_ring_sync(ring);
+	log_ring_uart->flush(log_ring_uart);
+}
+
+static void log_ring_flush(console_t *console)
+{
+	log_ring_drain((rz_log_ring_t *)console->base);
+}
+
+static console_t log_ring_console = {
+	.flags = CONSOLE_FLAG_BOOT,
+	.putc = log_ring_putc,
+	.flush = log_ring_flush,
+};
+
+static int log_ring_crash_putc(int c, console_t *console)
+{
+	rz_log_ring_t *ring = (rz_log_ring_t *)log_ring_console.base;
+
+	if (ring->pending != 0U)
+		log_ring_drain(ring);
+
+	return log_ring_uart->putc(c, log_ring_uart);
+}
+
+static void log_ring_crash_flush(console_t *console)
+{
+	log_ring_drain((rz_log_ring_t *)log_ring_console.base);
+}
+
+static console_t log_ring_crash_console = {
+	.flags = CONSOLE_FLAG_CRASH,
+	.putc = log_ring_crash_putc,
+	.flush = log_ring_crash_flush,
+};
+
+static void log_ring_init(rz_log_ring_t *ring, bool fresh)
+{
+	uint32_t size = RZ_LOG_RING_SIZE - sizeof(*ring);
+
+	if (fresh || (ring->magic != RZ_LOG_RING_MAGIC) ||
+	    (ring->size != size) || (ring->head >= size) ||
+	    (ring->pending > size)) {
+		ring->magic = RZ_LOG_RING_MAGIC;
+		ring->size = size;
+		ring->head = 0U;
+		ring->flags = 0U;
+		ring->pending = 0U;
+		flush_dcache_range((uintptr_t)ring, sizeof(*ring));
+	}
+
+	log_ring_clean = ring->head;
+}
+
+void rz_log_ring_register(console_t *uart, uintptr_t base, bool fresh)
+{
+	log_ring_init((rz_log_ring_t *)base, fresh);
+
+	log_ring_uart = uart;
+	log_ring_console.base = base;
+
+	(void)console_register(&log_ring_console);
+	(void)console_register(&log_ring_crash_console);
+}
+
+void rz_log_ring_move(uintptr_t base)
+{
+	rz_log_ring_t *from = (rz_log_ring_t *)log_ring_console.base;
+	rz_log_ring_t *to = (rz_log_ring_t *)base;
+	uint32_t pos, len;
+
+	assert(log_ring_uart != NULL);
+
+	log_ring_init(to, true);
+
+	/* Copy the log oldest byte first */
+	if ((from->flags & RZ_LOG_RING_WRAPPED) != 0U) {
+		pos = from->head;
+		len = from->size;
+	} else {
+		pos = 0U;
+		len = from->head;
+	}
+
+	while (len-- != 0U) {
+		log_ring_store(to, from->data[pos]);
+		if (++pos == from->size)
+			pos = 0U;
+	}
+
+	to->pending = MIN(from->pending, to->size);
+	flush_dcache_range(base, RZ_LOG_RING_SIZE);
+	log_ring_clean = to->head;
+
+	log_ring_console.base = base;
+}
+
+/* Overrides the generic handler so that a panic still reaches the UART */
+void __dead2 plat_panic_handler(void)
+{
+	if (log_ring_uart != NULL)
+		log_ring_drain((rz_log_ring_t *)log_ring_console.base);
+
+	for (;;)
+		wfi();
+}
@@ -12,6 +12,7 @@
 #include <arch_helpers.h>
 #include <rz_soc_def.h>
 #include <rz_sip_svc.h>
+#include <rz_boot_timeline.h>
 #include <sys_regs.h>
 
 
@@ -48,6 +49,21 @@ static uintptr_t rz_otp_handler_chipid(void *handle, u_register_t x1, u_register
 	SMC_RET4(handle, chipid[0], chipid[1], chipid[2], chipid[3]);
 }
 
+#if PLAT_BOOT_TIMELINE
+static uintptr_t rz_boot_timestamp_handler(void *handle, u_register_t x1)
+{
+	unsigned long long ts;
+
+	if ((x1 >= RZ_BOOT_TL_TOTAL_IDS) ||
+	    (rz_boot_timeline_get((unsigned int)x1, &ts) != 0)) {
+		WARN("%s: Invalid boot timestamp id\n", __func__);
+		SMC_RET1(handle, SMC_ARCH_CALL_INVAL_PARAM);
+	}
+
+	SMC_RET3(handle, SMC_OK, ts, read_cntfrq_el0());
+}
+#endif
+
 uintptr_t rz_plat_sip_handler(uint32_t smc_fid,
 					u_register_t x1,
 					u_register_t x2,
@@ -62,6 +78,10 @@ uintptr_t rz_plat_sip_handler(uint32_t smc_fid,
 		return rz_otp_handler_devid(handle, x1);
 	case RZ_SIP_SVC_GET_CHIPID:
 		return rz_otp_handler_chipid(handle, x1, flags);
+#if PLAT_BOOT_TIMELINE
+	case RZ_SIP_SVC_GET_BOOT_TIMESTAMP:
+		return rz_boot_timestamp_handler(handle, x1);
+#endif
 	default:
 		WARN("%s: Unimplemented RZ SiP Service Call: 0x%x\n", __func__, smc_fid);
 		SMC_RET1(handle, SMC_UNK);
@@ -19,6 +19,41 @@ DEBUG_FPGA						:= 0
 PLAT_DDR_ECC					:= 0
 PLAT_SYSTEM_SUSPEND				:= 0
 RESET_TO_BL31					:= 1
+PLAT_EMMC_DMA_ENABLE			:= 1
+# eMMC bus mode: 0 = HS52, 200 = HS200, 400 = HS400 (needs 1.8V VCCQ)
+PLAT_EMMC_BUS_MODE				:= 0
+# SD bus mode: 0 = DS, 1 = HS, 50 = SDR50, 104 = SDR104 (needs 1.8V signalling)
+PLAT_SD_BUS_MODE				:= 0
+# xSPI memory-mapped read: 0 = 1S-1S-1S, 1 = 1S-4D-4D DTR (falls back to 1S-1S-1S
+# if calibration fails); PLAT_XSPI_DTR_LATENCY is the flash's DTR dummy cycle count
+PLAT_XSPI_DTR					:= 0
+PLAT_XSPI_DTR_LATENCY			:= 8
+# Copy large FIP reads out of the xSPI window with the DMAC (falls back to the CPU)
+PLAT_SPI_DMA_ENABLE				:= 1
+# eMMC/SD sector cache: number of lines and sectors read ahead per line
+PLAT_SECTOR_CACHE_ENTRIES		:= 4
+PLAT_SECTOR_CACHE_READ_AHEAD	:= 4
+# Record a PMF timeline of the boot stages, print it at the end of BL2 and
+# serve it from BL31 over RZ_SIP_SVC_GET_BOOT_TIMESTAMP
+PLAT_BOOT_TIMELINE				:= 0
+# Keep the trained DDR PHY state in xSPI flash and restore it on cold boot
+# instead of training (SPI boot only; retrains if a quick memory check fails)
+PLAT_DDR_FAST_BOOT				:= 0
+# Initialise both DDR channels together, overlapping their training and BIST
+PLAT_DDR_CONCURRENT_INIT		:= 0
+# Let BL2 run independent jobs on the secondary cores, parked again before BL31
+PLAT_BL2_WORKERS				:= 0
+# Read BL32/BL33 compressed from the FIP into a scratch buffer in DRAM and
+# decompress them to their load address (PLAT_IMAGE_COMPRESSION: lz4 or gzip)
+PLAT_BL32_COMPRESS				:= 0
+PLAT_BL33_COMPRESS				:= 0
+PLAT_IMAGE_COMPRESSION			:= lz4
+# Decompress them while they are read, through a small window instead of the
+# scratch buffer (not authenticated, so not with TRUSTED_BOARD_BOOT)
+PLAT_IMAGE_STREAM				:= 0
+# Keep the BL2/BL31 log in a memory ring, sent to the UART only at the console
+# flush points and on panic; served to the OS over RZ_SIP_SVC_GET_LOG_RING
+PLAT_LOG_RING					:= 0
 
 ifneq (${PLAT_SYSTEM_SUSPEND},0)
 override PLAT_SYSTEM_SUSPEND	:= 1
@@ -29,6 +64,22 @@ $(eval $(call add_define,PROTECTED_CHIPID))
 $(eval $(call add_define,DEBUG_FPGA))
 $(eval $(call add_define,PLAT_DDR_ECC))
 $(eval $(call add_define,PLAT_SYSTEM_SUSPEND))
+$(eval $(call add_define,PLAT_EMMC_DMA_ENABLE))
+$(eval $(call add_define,PLAT_EMMC_BUS_MODE))
+$(eval $(call add_define,PLAT_SD_BUS_MODE))
+$(eval $(call add_define,PLAT_XSPI_DTR))
+$(eval $(call add_define,PLAT_XSPI_DTR_LATENCY))
+$(eval $(call add_define,PLAT_SPI_DMA_ENABLE))
+$(eval $(call add_define,PLAT_SECTOR_CACHE_ENTRIES))
+$(eval $(call add_define,PLAT_SECTOR_CACHE_READ_AHEAD))
+$(eval $(call add_define,PLAT_BOOT_TIMELINE))
+$(eval $(call add_define,PLAT_DDR_FAST_BOOT))
+$(eval $(call add_define,PLAT_DDR_CONCURRENT_INIT))
+$(eval $(call add_define,PLAT_BL2_WORKERS))
+$(eval $(call add_define,PLAT_LOG_RING))
+$(eval $(call add_define,PLAT_BL32_COMPRESS))
+$(eval $(call add_define,PLAT_BL33_COMPRESS))
+$(eval $(call add_define,PLAT_IMAGE_STREAM))
 $(eval $(call add_define,PLAT_EXTRA_LD_SCRIPT))
 ifeq (${BOARD}, evk_1)
 $(eval $(call add_define,BOOT_MODE_eMMC_NOT_SUPPORTED))
@@ -70,6 +121,10 @@ endif
 
 XSPI_SOURCES			:=	plat/renesas/rz/common/drivers/xspi.c	\
 							plat/renesas/rz/common/drivers/io/io_xspidrv.c
+ifeq (${PLAT_SPI_DMA_ENABLE},1)
+XSPI_SOURCES			+=	plat/renesas/rz/common/drivers/dmac.c	\
+							plat/renesas/rz/common/drivers/io/io_spidrv.c
+endif
 ifneq (${BOARD}, evk_1)
 EMMC_SOURCES			:=	plat/renesas/rz/common/drivers/io/io_emmcdrv.c		\
 							plat/renesas/rz/common/drivers/emmc/emmc_interrupt.c	\
@@ -89,7 +144,8 @@ SD_SOURCES				:=	plat/renesas/rz/common/drivers/sd/sd_init.c			\
 							plat/renesas/rz/common/drivers/sd/sd_read.c			\
 							plat/renesas/rz/common/drivers/sd/sd_write.c		\
 							plat/renesas/rz/common/drivers/sd/sd_dev_low.c		\
-							plat/renesas/rz/common/drivers/io/io_sddrv.c
+							plat/renesas/rz/common/drivers/io/io_sddrv.c		\
+							plat/renesas/rz/common/drivers/io/io_sector_cache.c
 
 BL2_SOURCES				+=	common/desc_image_load.c							\
 							drivers/io/io_storage.c								\
@@ -113,6 +169,60 @@ BL31_SOURCES			:=	plat/common/plat_gicv3.c							\
 							plat/renesas/rz/common/rz_sip_svc.c					\
 							${GICV3_SOURCES}
 
+ifeq (${PLAT_BOOT_TIMELINE},1)
+ENABLE_PMF				:=	1
+BL2_SOURCES				+=	lib/pmf/pmf_main.c									\
+							plat/renesas/rz/common/rz_boot_timeline.c
+BL31_SOURCES			+=	plat/renesas/rz/common/rz_boot_timeline.c
+endif
+
+ifeq (${PLAT_LOG_RING},1)
+BL2_SOURCES				+=	plat/renesas/rz/common/rz_log_ring.c
+BL31_SOURCES			+=	plat/renesas/rz/common/rz_log_ring.c
+endif
+
+ifeq (${PLAT_DDR_FAST_BOOT},1)
+# The training record is checked with the CRC32 instructions
+BL2_SOURCES				+=	common/tf_crc32.c
+BL2_CPPFLAGS			+=	-march=armv8-a+crc
+endif
+
+PLAT_IMAGE_GZIP			:=	0
+ifneq ($(filter 1,${PLAT_BL32_COMPRESS} ${PLAT_BL33_COMPRESS}),)
+ifeq (${PLAT_BL32_COMPRESS}${PLAT_BL33_COMPRESS}${BL2_PIPELINED_LOAD}${PLAT_IMAGE_STREAM},1110)
+$(error PLAT_BL32_COMPRESS and PLAT_BL33_COMPRESS share one scratch buffer, which needs BL2_PIPELINED_LOAD=0)
+endif
+ifeq (${PLAT_IMAGE_STREAM}${TRUSTED_BOARD_BOOT},11)
+$(error PLAT_IMAGE_STREAM does not authenticate the images, which TRUSTED_BOARD_BOOT needs)
+endif
+BL2_SOURCES				+=	common/image_decompress.c
+ifeq (${PLAT_IMAGE_COMPRESSION},lz4)
+include lib/lz4/lz4.mk
+BL2_SOURCES				+=	${LZ4_SOURCES}
+PLAT_IMAGE_FILTER		:=	LZ4
+# Independent blocks, so that unlz4() can spread them over the BL2 workers
+ifeq (${PLAT_BL2_WORKERS}${PLAT_IMAGE_STREAM},10)
+LZ4_INDEPENDENT_BLOCKS	:=	1
+endif
+else ifeq (${PLAT_IMAGE_COMPRESSION},gzip)
+include lib/zlib/zlib.mk
+# tf_gunzip.c provides tf_crc32() itself
+BL2_SOURCES				:=	$(filter-out common/tf_crc32.c,${BL2_SOURCES})	\
+							${ZLIB_SOURCES}
+PLAT_IMAGE_FILTER		:=	GZIP
+PLAT_IMAGE_GZIP			:=	1
+else
+$(error Unknown PLAT_IMAGE_COMPRESSION ${PLAT_IMAGE_COMPRESSION})
+endif
+ifeq (${PLAT_BL32_COMPRESS},1)
+BL32_PRE_TOOL_FILTER	:=	${PLAT_IMAGE_FILTER}
+endif
+ifeq (${PLAT_BL33_COMPRESS},1)
+BL33_PRE_TOOL_FILTER	:=	${PLAT_IMAGE_FILTER}
+endif
+endif
+$(eval $(call add_define,PLAT_IMAGE_GZIP))
+
 ifneq (${TRUSTED_BOARD_BOOT},0)
 
 	# Include common TBB sources
@@ -25,6 +25,8 @@
 #include <rz_private.h>
 #include <sys.h>
 #include <pwrc.h>
+#include <bl2_workers.h>
+#include <rz_log_ring.h>
 
 extern void bl2_enter_bl31(const struct entry_point_info *bl_ep_info);
 static console_t rzv2h_bl2_console;
@@ -39,6 +41,9 @@ static uint32_t bl2_plat_get_boot_mode(void)
 
 int bl2_plat_handle_pre_image_load(unsigned int image_id)
 {
+	RZ_BOOT_TL_IMAGE_START(image_id, RZ_BOOT_TL_IMAGE_LOAD);
+	rz_image_decompress_prepare(image_id);
+
 	if (image_id == BL31_IMAGE_ID) {
 		bl2_to_bl31_params_mem_t *params = (bl2_to_bl31_params_mem_t *)PARAMS_BASE;
 
@@ -50,6 +55,8 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 
 			bl_mem_params->image_info.h.attr |= IMAGE_ATTRIB_SKIP_LOADING;
 			flush_dcache_range((uintptr_t)PARAMS_BASE, sizeof(bl2_to_bl31_params_mem_t));
+			bl2_workers_park();
+			console_flush();
 			bl2_enter_bl31(&bl_mem_params->ep_info);
 		}
 	}
@@ -61,12 +68,19 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
 	static bl2_to_bl31_params_mem_t *params;
 	bl_mem_params_node_t *bl_mem_params;
+	int ret;
 
 	if (!params) {
 		params = (bl2_to_bl31_params_mem_t *) PARAMS_BASE;
 		memset((void *)PARAMS_BASE, 0, sizeof(bl2_to_bl31_params_mem_t));
 	}
 
+	ret = rz_image_decompress(image_id);
+	if (ret != 0)
+		return ret;
+
+	RZ_BOOT_TL_IMAGE_END(image_id, RZ_BOOT_TL_IMAGE_LOAD);
+
 	bl_mem_params = get_bl_mem_params_node(image_id);
 
 	switch (image_id) {
@@ -81,6 +95,12 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 	case BL33_IMAGE_ID:
 		memcpy(&params->bl33_ep_info, &bl_mem_params->ep_info,
 			sizeof(entry_point_info_t));
+		/* BL31 owns the secondary cores from here on */
+		bl2_workers_park();
+#if PLAT_BOOT_TIMELINE
+		/* BL33 is the last image BL2 loads */
+		rz_boot_timeline_report(params->boot_timeline);
+#endif
 		break;
 	default:
 		/* Do nothing in default case */
@@ -106,10 +126,14 @@ void bl2_el3_early_platform_setup(u_register_t arg1, u_register_t arg2,
 	generic_delay_timer_init();
 
 	/* setup PFC */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_PFC);
 	pfc_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_PFC);
 
 	/* setup Clock and Reset */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_CPG);
 	cpg_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_CPG);
 
 	/* initialize console driver */
 	ret = console_rz_register(
@@ -120,8 +144,14 @@ void bl2_el3_early_platform_setup(u_register_t arg1, u_register_t arg2,
 	if (!ret)
 		panic();
 
+#if PLAT_LOG_RING
+	/* The UART is fed from the log ring, crash output included */
+	console_set_scope(&rzv2h_bl2_console, 0U);
+	rz_log_ring_register(&rzv2h_bl2_console, RZ_LOG_RING_EARLY_BASE, true);
+#else
 	console_set_scope(&rzv2h_bl2_console,
 			CONSOLE_FLAG_BOOT | CONSOLE_FLAG_CRASH);
+#endif
 
 	pwrc_setup();
 }
@@ -137,6 +167,12 @@ void bl2_el3_plat_arch_setup(void)
 				MT_MEMORY | MT_RO | MT_SECURE),
 		MAP_REGION_FLAT(PARAMS_BASE, PARAMS_SIZE,
 				MT_MEMORY | MT_RW | MT_SECURE),
+#if PLAT_LOG_RING
+		MAP_REGION_FLAT(RZ_LOG_RING_EARLY_BASE, RZ_LOG_RING_SIZE,
+				MT_MEMORY | MT_RW | MT_SECURE),
+		MAP_REGION_FLAT(RZ_LOG_RING_BASE, RZ_LOG_RING_SIZE,
+				MT_MEMORY | MT_RW | MT_NS),
+#endif
 #if SEPARATE_CODE_AND_RODATA
 		MAP_REGION_FLAT(BL_RO_DATA_BASE, BL_RO_DATA_END - BL_RO_DATA_BASE,
 				MT_RO_DATA | MT_SECURE),
@@ -155,6 +191,11 @@ void bl2_el3_plat_arch_setup(void)
 				MT_MEMORY | MT_RO | MT_SECURE),
 		MAP_REGION_FLAT(RZV2H_DDR0_BASE, RZV2H_DDR0_SIZE,
 				MT_MEMORY | MT_RW | MT_SECURE),
+#if PLAT_DDR_FAST_BOOT
+		/* For the memory check after restoring DDR1 */
+		MAP_REGION_FLAT(RZV2H_DDR1_BASE, RZV2H_DDR1_SIZE,
+				MT_MEMORY | MT_RW | MT_SECURE),
+#endif
 		{0}
 	};
 
@@ -167,8 +208,20 @@ void bl2_platform_setup(void)
 	/* Setup TZC-400, Access Control */
 	plat_security_setup();
 
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_IO_SETUP);
 	rz_io_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_IO_SETUP);
 
 	/* initialize DDR */
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_DDR);
 	plat_ddr_setup();
+	RZ_BOOT_TL_STAGE_END(RZ_BOOT_TL_DDR);
+
+#if PLAT_LOG_RING
+	/*
+	 * Move the log to the ring in DRAM the OS is given. The OS may have
+	 * used that memory before a resume, so the log is never appended to.
+	 */
+	rz_log_ring_move(RZ_LOG_RING_BASE);
+#endif
 }
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <arch.h>
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/delay_timer.h>
+#include <plat/common/platform.h>
+#include <bl2_workers.h>
+#include <pwrc.h>
+
+#define WORKER_OFF		0U
+#define WORKER_READY	1U
+#define WORKER_PARKED	2U
+
+/* A core not running the worker loop by then is left out */
+#define WORKER_START_TIMEOUT_US		10000U
+
+/*
+ * Each worker has a one-slot mailbox written only by the boot core and a
+ * status word written only by the worker, in separate cache lines. A job is
+ * pending while 'posted' differs from 'done', so neither side needs a lock.
+ */
+struct bl2_mailbox {
+	bl2_job_fn_t fn;
+	void *arg;
+	volatile unsigned int posted;
+	volatile bool park;
+	bool active;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+struct bl2_status {
+	volatile unsigned int done;
+	volatile unsigned int state;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct bl2_mailbox mailbox[PLATFORM_CORE_COUNT];
+static struct bl2_status status[PLATFORM_CORE_COUNT];
+static unsigned int boot_core;
+static bool started;
+
+uint8_t bl2_worker_stacks[PLATFORM_CORE_COUNT][BL2_WORKER_STACK_SIZE]
+	__aligned(16);
+
+void bl2_worker_entry(void);
+void bl2_worker_flush(void);
+void __dead2 bl2_worker_main(void);
+
+void __dead2 bl2_worker_main(void)
+{
+	unsigned int core = plat_my_core_pos();
+	struct bl2_mailbox *mbox = &mailbox[core];
+	struct bl2_status *st = &status[core];
+	unsigned int posted;
+
+	st->state = WORKER_READY;
+	dsbish();
+	sev();
+
+	while (true) {
+		while (((posted = mbox->posted) == st->done) && !mbox->park)
+			wfe();
+
+		if (posted == st->done)
+			break;
+
+		/* Read the job only after seeing it posted */
+		dmbish();
+		mbox->fn(mbox->arg);
+
+		/* Publish the job's results before completing it */
+		dmbish();
+		st->done = posted;
+		dsbish();
+		sev();
+	}
+
+	/* Caches are off from here, so the boot core reads the state from DRAM */
+	bl2_worker_flush();
+	st->state = WORKER_PARKED;
+	dsb();
+
+	pwrc_cpu_off(core);
+	while (true)
+		wfi();
+}
+
+static void bl2_workers_start(void)
+{
+	unsigned int i;
+	unsigned int count = 0U;
+	uint64_t timeout;
+
+	/*
+	 * The workers turn on their MMU with mmu_cfg_params and the translation
+	 * tables, which the boot core wrote before its own MMU was on.
+	 */
+	boot_core = plat_my_core_pos();
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (i == boot_core)
+			continue;
+
+		mailbox[i].park = false;
+		pwrc_set_reset_vector(i, (uintptr_t)&bl2_worker_entry);
+		pwrc_cpu_on(i);
+	}
+
+	timeout = timeout_init_us(WORKER_START_TIMEOUT_US);
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (i == boot_core)
+			continue;
+
+		while ((status[i].state != WORKER_READY) &&
+		       !timeout_elapsed(timeout))
+			;
+
+		mailbox[i].active = (status[i].state == WORKER_READY);
+		if (mailbox[i].active)
+			count++;
+		else
+			WARN("BL2: core %u did not start, running without it\n", i);
+	}
+
+	started = true;
+	INFO("BL2: %u worker cores started\n", count);
+}
+
+void bl2_workers_submit(bl2_job_fn_t fn, void *arg)
+{
+	unsigned int i;
+
+	/* The workers need the boot core's MMU configuration to start */
+	if (!started && ((read_sctlr_el3() & SCTLR_M_BIT) != 0U))
+		bl2_workers_start();
+
+	for (i = 0U; started && (i < PLATFORM_CORE_COUNT); i++) {
+		if (!mailbox[i].active || (mailbox[i].posted != status[i].done))
+			continue;
+
+		mailbox[i].fn = fn;
+		mailbox[i].arg = arg;
+		dmbish();
+		mailbox[i].posted++;
+		dsbish();
+		sev();
+		return;
+	}
+
+	/* Every worker is busy */
+	fn(arg);
+}
+
+void bl2_workers_wait(void)
+{
+	unsigned int i;
+
+	for (i = 0U; started && (i < PLATFORM_CORE_COUNT); i++) {
+		while (status[i].done != mailbox[i].posted)
+			wfe();
+	}
+
+	/* Read the results only after seeing the jobs done */
+	dmbish();
+}
+
+void bl2_workers_park(void)
+{
+	unsigned int i;
+
+	if (!started)
+		return;
+
+	bl2_workers_wait();
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++)
+		mailbox[i].park = true;
+	dsbish();
+	sev();
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (!mailbox[i].active)
+			continue;
+
+		do {
+			inv_dcache_range((uintptr_t)&status[i], sizeof(status[i]));
+		} while (status[i].state != WORKER_PARKED);
+	}
+
+	/* Back to the reset vector BL31 expects for PSCI CPU_ON */
+	pwrc_setup();
+	started = false;
+	INFO("BL2: worker cores parked\n");
+}
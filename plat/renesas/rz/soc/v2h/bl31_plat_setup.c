@@ -16,6 +16,7 @@
 #include <rz_private.h>
 #include <rz_soc_def.h>
 #include <pwrc.h>
+#include <rz_log_ring.h>
 
 static console_t rzv2h_bl31_console;
 static bl2_to_bl31_params_mem_t from_bl2;
@@ -69,11 +70,22 @@ void bl31_early_platform_setup2(u_register_t arg0,
 	if (!ret)
 		panic();
 
+#if PLAT_LOG_RING
+	/* Boot messages go on in the ring BL2 left, runtime ones to the UART */
+	console_set_scope(&rzv2h_bl31_console, CONSOLE_FLAG_RUNTIME);
+	rz_log_ring_register(&rzv2h_bl31_console, RZ_LOG_RING_BASE, false);
+#else
 	console_set_scope(&rzv2h_bl31_console,
 			CONSOLE_FLAG_BOOT | CONSOLE_FLAG_RUNTIME | CONSOLE_FLAG_CRASH);
+#endif
 
 	/* copy bl2_to_bl31_params_mem_t*/
 	memcpy(&from_bl2, (void *)PARAMS_BASE, sizeof(from_bl2));
+
+#if PLAT_BOOT_TIMELINE
+	rz_boot_timeline_restore(from_bl2.boot_timeline);
+#endif
+	RZ_BOOT_TL_STAGE_START(RZ_BOOT_TL_BL31_SETUP);
 }
 
 void bl31_plat_arch_setup(void)
@@ -85,6 +97,10 @@ void bl31_plat_arch_setup(void)
 						MT_CODE | MT_SECURE),
 		MAP_REGION_FLAT(BL_RO_DATA_BASE, BL_RO_DATA_END - BL_RO_DATA_BASE,
 						MT_RO_DATA | MT_SECURE),
+#if PLAT_LOG_RING
+		MAP_REGION_FLAT(RZ_LOG_RING_BASE, RZ_LOG_RING_SIZE,
+						MT_MEMORY | MT_RW | MT_NS),
+#endif
 		{0}
 	};
 
@@ -4,11 +4,18 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stddef.h>
 #include <stdint.h>
+#include <arch_helpers.h>
 #include <common/debug.h>
+#if PLAT_DDR_FAST_BOOT
+#include <common/tf_crc32.h>
+#endif
 #include <drivers/delay_timer.h>
+#include <lib/cassert.h>
 #include "ddr_regs.h"
 #include "rz_soc_def.h"
+#include "sys_regs.h"
 #include "cpg.h"
 #include "ddr_private.h"
 #include <ddr.h>
@@ -16,6 +23,40 @@
 
 #define MCAR_CTL				0x800
 
+#define DDR_NUM_CH				2U
+#define DDR_CH(ddrbase)			(((ddrbase) == RZV2H_DDR0_BASE) ? 0U : 1U)
+#define DDR_BASE(ch)			(((ch) == 0U) ? RZV2H_DDR0_BASE : RZV2H_DDR1_BASE)
+
+#if PLAT_DDR_FAST_BOOT
+/*
+ * Record of the trained CSRs of both channels, laid out as save_retcsr() reads
+ * them. The fingerprint ties it to the SoC revision and the DDR parameters it
+ * was trained with, and the CRC covers everything before it.
+ */
+#define DDR_TRAIN_MAGIC			0x4e525444U	/* "DTRN" */
+#define DDR_TRAIN_VERSION		1U
+#define DDR_TRAIN_CSR_MAX		380U
+
+struct ddr_train_record {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t fingerprint;
+	uint32_t num_csr;
+	uint32_t csr[DDR_NUM_CH][DDR_TRAIN_CSR_MAX];
+	uint32_t crc;
+};
+
+CASSERT(sizeof(struct ddr_train_record) <= DDR_TRAIN_SIZE,
+	assert_ddr_train_record_size);
+
+#define ddr_train_rec			((struct ddr_train_record *)ddr_train_table)
+
+/* Quick check after a restore: the first page, then one word per address bit */
+#define DDR_CHECK_WORDS			512U
+#define DDR_CHECK_BIT_MIN		12U
+#define DDR_CHECK_BIT_MAX		28U
+#endif /* PLAT_DDR_FAST_BOOT */
+
 
 extern const uint32_t retention_phyreglist_1d[];
 extern const uint32_t retention_phyreglist_2d[];
@@ -25,30 +66,60 @@ extern const uint32_t retention_phyreglist_2d_size;
 extern const uint32_t retention_mcreglist_size;
 
 
-static void ddr_init(uint64_t ddraddr);
 static void phyinit_c(void);
-static void phyinit_d2h_1d(void);
-static void phyinit_d2h_2d(void);
 static void phyinit_mc(void);
 static void phyinit_i(void);
 static void phyinit_j(void);
+static void save_retcsr(uint64_t ddrbase);
+static void restore_retcsr(const uint32_t *table);
+#if PLAT_DDR_FAST_BOOT
+static uint32_t ddr_train_num_csr(void);
+#endif
+#if PLAT_DDR_CONCURRENT_INIT
+static void ddr_init_concurrent(void);
+#endif
+
+/*
+ * Channel-at-a-time initialisation, used by ddr_setup() unless
+ * PLAT_DDR_CONCURRENT_INIT is set and by PLAT_DDR_FAST_BOOT to retrain a
+ * single channel
+ */
+#define DDR_SEQUENTIAL_INIT	(!PLAT_DDR_CONCURRENT_INIT || PLAT_DDR_FAST_BOOT)
+#if DDR_SEQUENTIAL_INIT
+static void ddr_init(uint64_t ddraddr);
+static void phyinit_d2h_1d(void);
+static void phyinit_d2h_2d(void);
 static void prog_all0(uint64_t start_addr, uint32_t addr_space);
-static void save_retcsr(void);
+#endif
 
 
 void ddr_setup(void)
 {
 	INFO("DDR: Setup (Rev. %s)\n", DDR_VERSION);
+#if PLAT_DDR_CONCURRENT_INIT
+	ddr_init_concurrent();
+#else
 	ddr_init(RZV2H_DDR0_BASE);
 	ddr_init(RZV2H_DDR1_BASE);
+#endif
 }
 
 
-static void ddr_init(uint64_t ddrbase)
+static void ddr_select(uint64_t ddrbase)
 {
 	if (ddrbase == RZV2H_DDR0_BASE) {
 		set_ddrtop_mc_base_addr(RZV2H_DDR0_MEMC_BASE);
 		set_ddrphy_base_addr(RZV2H_DDR0_PHY_BASE);
+	} else {
+		set_ddrtop_mc_base_addr(RZV2H_DDR1_MEMC_BASE);
+		set_ddrphy_base_addr(RZV2H_DDR1_PHY_BASE);
+	}
+}
+
+static void ddr_ctl_setup(uint64_t ddrbase)
+{
+	if (ddrbase == RZV2H_DDR0_BASE) {
+		ddr_select(ddrbase);
 
 		cpg_ddr0_part1();
 
@@ -56,8 +127,7 @@ static void ddr_init(uint64_t ddrbase)
 
 		cpg_ddr0_part2();
 	} else if (ddrbase == RZV2H_DDR1_BASE) {
-		set_ddrtop_mc_base_addr(RZV2H_DDR1_MEMC_BASE);
-		set_ddrphy_base_addr(RZV2H_DDR1_PHY_BASE);
+		ddr_select(ddrbase);
 
 		cpg_ddr1_part1();
 
@@ -67,6 +137,12 @@ static void ddr_init(uint64_t ddrbase)
 	} else {
 		panic();
 	}
+}
+
+#if DDR_SEQUENTIAL_INIT
+static void ddr_init(uint64_t ddrbase)
+{
+	ddr_ctl_setup(ddrbase);
 
 	phyinit_c();
 
@@ -76,7 +152,7 @@ static void ddr_init(uint64_t ddrbase)
 
 	phyinit_mc();
 
-	save_retcsr();
+	save_retcsr(ddrbase);
 
 	phyinit_i();
 
@@ -86,6 +162,7 @@ static void ddr_init(uint64_t ddrbase)
 
 	update_mc();
 }
+#endif
 
 static void phyinit_c(void)
 {
@@ -93,6 +170,7 @@ static void phyinit_c(void)
 	phyinit_pin_swizzling();
 }
 
+#if DDR_SEQUENTIAL_INIT
 static void phyinit_d2h_1d(void)
 {
 	phyinit_load_1d_image();
@@ -104,6 +182,7 @@ static void phyinit_d2h_2d(void)
 	phyinit_load_2d_image();
 	phyinit_exec_2d_image();
 }
+#endif
 
 static void phyinit_i(void)
 {
@@ -199,40 +278,55 @@ static void phyinit_mc(void)
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 }
 
-static void save_retcsr(void)
+static void read_retcsr(uint32_t *table)
 {
-	static bool saved;
 	uint32_t i, j = 0;
 
+	for (i = 0; i < retention_phyreglist_1d_size; i++, j++) {
+		table[j] = dwc_ddrphy_apb_rd(retention_phyreglist_1d[i]);
+	}
+
+	for (i = 0; i < retention_phyreglist_2d_size; i++, j++) {
+		table[j] = dwc_ddrphy_apb_rd(retention_phyreglist_2d[i]);
+	}
+
+	for (i = 0; i < retention_mcreglist_size; i++, j++) {
+		table[j] = ddrtop_mc_apb_rd(retention_mcreglist[i]);
+	}
+}
+
+/* Set once ddr_csr_table holds the retention registers saved for resume */
+static bool ddr_csr_saved;
+
+static void save_retcsr(uint64_t ddrbase)
+{
+	uint32_t i;
+
 	dwc_ddrphy_apb_wr(0x0d0000, 0);
 	dwc_ddrphy_apb_wr(0x0c0080, 3);
 
-	if (!saved) {
+	if (!ddr_csr_saved) {
 		/* Clear buffer */
 		for (i = 0; i < ARRAY_SIZE(ddr_csr_table); i++)
 			ddr_csr_table[i] = ~0x0;
 
 		/* Read all the retention registers, and save them to the storage other than DRAM. */
-		for (i = 0; i < retention_phyreglist_1d_size; i++, j++) {
-			ddr_csr_table[j] = dwc_ddrphy_apb_rd(retention_phyreglist_1d[i]);
-		}
-
-		for (i = 0; i < retention_phyreglist_2d_size; i++, j++) {
-			ddr_csr_table[j] = dwc_ddrphy_apb_rd(retention_phyreglist_2d[i]);
-		}
-
-		for (i = 0; i < retention_mcreglist_size; i++, j++) {
-			ddr_csr_table[j] = ddrtop_mc_apb_rd(retention_mcreglist[i]);
-		}
+		read_retcsr(ddr_csr_table);
 
-		saved = true;
+		ddr_csr_saved = true;
 	}
 
+#if PLAT_DDR_FAST_BOOT
+	/* Every channel keeps its own copy for the next cold boot */
+	if (ddr_train_num_csr() <= DDR_TRAIN_CSR_MAX)
+		read_retcsr(ddr_train_rec->csr[DDR_CH(ddrbase)]);
+#endif
+
 	dwc_ddrphy_apb_wr(0x0c0080, 2);
 	dwc_ddrphy_apb_wr(0x0d0000, 1);
 }
 
-static void restore_retcsr(void)
+static void restore_retcsr(const uint32_t *table)
 {
 	uint32_t i, j = 0;
 
@@ -240,26 +334,26 @@ static void restore_retcsr(void)
 	dwc_ddrphy_apb_wr(0x0c0080, 3);
 
 	for (i = 0; i < retention_phyreglist_1d_size; i++, j++) {
-		dwc_ddrphy_apb_wr(retention_phyreglist_1d[i], ddr_csr_table[j]);
+		dwc_ddrphy_apb_wr(retention_phyreglist_1d[i], table[j]);
 	}
 
 	for (i = 0; i < retention_phyreglist_2d_size; i++, j++) {
-		dwc_ddrphy_apb_wr(retention_phyreglist_2d[i], ddr_csr_table[j]);
+		dwc_ddrphy_apb_wr(retention_phyreglist_2d[i], table[j]);
 	}
 
 	for (i = 0; i < retention_mcreglist_size; i++, j++) {
-		dwc_ddrphy_apb_wr(retention_mcreglist[i], ddr_csr_table[j]);
+		ddrtop_mc_apb_wr(retention_mcreglist[i], table[j]);
 	}
 
 	dwc_ddrphy_apb_wr(0x0c0080, 2);
 	dwc_ddrphy_apb_wr(0x0d0000, 1);
 }
 
-static void prog_all0(uint64_t start_addr, uint32_t addr_space)
+static uint32_t prog_all0_start(uint64_t start_addr, uint32_t addr_space)
 {
-#if PLAT_DDR_ECC
-	uint32_t bak_lp_auto_entry_en;
+	uint32_t bak_lp_auto_entry_en = 0;
 
+#if PLAT_DDR_ECC
 	ddrtop_mc_param_wr(ECC_DISABLE_W_UC_ERR_ADDR, ECC_DISABLE_W_UC_ERR_OFFSET, ECC_DISABLE_W_UC_ERR_WIDTH, 1);
 
 	bak_lp_auto_entry_en = ddrtop_mc_param_rd(LP_AUTO_ENTRY_EN_ADDR, LP_AUTO_ENTRY_EN_OFFSET, LP_AUTO_ENTRY_EN_WIDTH);
@@ -278,6 +372,14 @@ static void prog_all0(uint64_t start_addr, uint32_t addr_space)
 	udelay(1);
 
 	ddrtop_mc_param_wr(BIST_GO_ADDR, BIST_GO_OFFSET, BIST_GO_WIDTH, 1);
+#endif
+
+	return bak_lp_auto_entry_en;
+}
+
+static void prog_all0_end(uint32_t bak_lp_auto_entry_en)
+{
+#if PLAT_DDR_ECC
 	ddrtop_mc_param_poll(INT_STATUS_BIST_ADDR, INT_STATUS_BIST_OFFSET+0, 1, 1);
 	ddrtop_mc_param_wr(BIST_GO_ADDR, BIST_GO_OFFSET, BIST_GO_WIDTH, 0);
 	ddrtop_mc_param_wr(INT_ACK_BIST_ADDR, INT_ACK_BIST_OFFSET+0, 1, 1);
@@ -291,6 +393,13 @@ static void prog_all0(uint64_t start_addr, uint32_t addr_space)
 #endif
 }
 
+#if DDR_SEQUENTIAL_INIT
+static void prog_all0(uint64_t start_addr, uint32_t addr_space)
+{
+	prog_all0_end(prog_all0_start(start_addr, addr_space));
+}
+#endif
+
 static void soft_delay(uint64_t usec)
 {
 	/* RZ/V2H: CPU Clock = 1.7G Hz*/
@@ -440,7 +549,7 @@ void ddr_retention_exit(uint8_t base)
 	phyinit_c();
 
 	/* 16. */
-	restore_retcsr();
+	restore_retcsr(ddr_csr_table);
 
 	/* 17. */
 	phyinit_i();
@@ -451,3 +560,223 @@ void ddr_retention_exit(uint8_t base)
 	/* 19. */
 	update_mc();
 }
+
+#if PLAT_DDR_FAST_BOOT
+static uint32_t ddr_train_num_csr(void)
+{
+	return retention_phyreglist_1d_size + retention_phyreglist_2d_size +
+	       retention_mcreglist_size;
+}
+
+static uint32_t ddr_train_fingerprint(void)
+{
+	uint32_t prr = mmio_read_32(SYS_LSI_PRR);
+	uint32_t crc;
+
+	crc = ddr_param_crc();
+	crc = tf_crc32(crc, (const unsigned char *)DDR_VERSION,
+		       sizeof(DDR_VERSION));
+	return tf_crc32(crc, (const unsigned char *)&prr, sizeof(prr));
+}
+
+static uint32_t ddr_train_crc(void)
+{
+	return tf_crc32(0U, (const unsigned char *)ddr_train_rec,
+			offsetof(struct ddr_train_record, crc));
+}
+
+static void ddr_train_seal(void)
+{
+	ddr_train_rec->magic = DDR_TRAIN_MAGIC;
+	ddr_train_rec->version = DDR_TRAIN_VERSION;
+	ddr_train_rec->fingerprint = ddr_train_fingerprint();
+	ddr_train_rec->num_csr = ddr_train_num_csr();
+	ddr_train_rec->crc = ddr_train_crc();
+}
+
+static bool ddr_train_valid(void)
+{
+	if ((ddr_train_rec->magic != DDR_TRAIN_MAGIC) ||
+	    (ddr_train_rec->version != DDR_TRAIN_VERSION) ||
+	    (ddr_train_rec->num_csr != ddr_train_num_csr()) ||
+	    (ddr_train_rec->crc != ddr_train_crc()))
+		return false;
+
+	/* A different SoC revision or DDR setting needs training again */
+	return ddr_train_rec->fingerprint == ddr_train_fingerprint();
+}
+
+/*
+ * Write the address of every word to it, then its complement, so that a bad
+ * delay shows up as a data error and a bad address mapping as an alias.
+ */
+static bool ddr_quick_check(uint64_t ddrbase)
+{
+	uint64_t *mem = (uint64_t *)ddrbase;
+	uint64_t *word;
+	uint64_t invert;
+	uint32_t i, pass;
+
+	for (pass = 0U; pass < 2U; pass++) {
+		invert = (pass == 0U) ? 0ULL : ~0ULL;
+
+		for (i = 0U; i < DDR_CHECK_WORDS; i++)
+			mem[i] = (uint64_t)&mem[i] ^ invert;
+		flush_dcache_range((uintptr_t)mem, DDR_CHECK_WORDS * sizeof(*mem));
+
+		for (i = DDR_CHECK_BIT_MIN; i < DDR_CHECK_BIT_MAX; i++) {
+			word = (uint64_t *)(ddrbase + (1ULL << i));
+			*word = (uint64_t)word ^ invert;
+			flush_dcache_range((uintptr_t)word, sizeof(*word));
+		}
+
+		for (i = 0U; i < DDR_CHECK_WORDS; i++) {
+			if (mem[i] != ((uint64_t)&mem[i] ^ invert))
+				return false;
+		}
+
+		for (i = DDR_CHECK_BIT_MIN; i < DDR_CHECK_BIT_MAX; i++) {
+			word = (uint64_t *)(ddrbase + (1ULL << i));
+			if (*word != ((uint64_t)word ^ invert))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/* Bring a channel up from its saved CSRs, skipping 1D/2D training */
+static bool ddr_restore(uint64_t ddrbase)
+{
+	uint32_t i;
+
+	ddr_ctl_setup(ddrbase);
+
+	phyinit_c();
+
+	restore_retcsr(ddr_train_rec->csr[DDR_CH(ddrbase)]);
+
+	/* Keep what save_retcsr() would have, for the retention info of resume */
+	if (!ddr_csr_saved) {
+		for (i = 0U; i < ARRAY_SIZE(ddr_csr_table); i++)
+			ddr_csr_table[i] = (i < ddr_train_num_csr()) ?
+				ddr_train_rec->csr[DDR_CH(ddrbase)][i] : ~0U;
+
+		ddr_csr_saved = true;
+	}
+
+	phyinit_i();
+
+	phyinit_j();
+
+	prog_all0(ddrbase, 33);
+
+	update_mc();
+
+	return ddr_quick_check(ddrbase);
+}
+
+/*
+ * Set up both channels from the training record in ddr_train_table, training
+ * the ones it cannot bring up. Returns true when the record was rebuilt and
+ * should be written back.
+ */
+bool ddr_setup_fast(void)
+{
+	bool retrained = false;
+	uint32_t ch;
+
+	if (ddr_train_num_csr() > DDR_TRAIN_CSR_MAX) {
+		WARN("DDR: Retention list too large for the training record\n");
+		ddr_setup();
+		return false;
+	}
+
+	if (!ddr_train_valid()) {
+		INFO("DDR: No valid training record\n");
+		ddr_setup();
+		ddr_train_seal();
+		return true;
+	}
+
+	INFO("DDR: Setup (Rev. %s) from training record\n", DDR_VERSION);
+	for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+		if (ddr_restore(DDR_BASE(ch)))
+			continue;
+
+		WARN("DDR: Channel %u failed the check, training it\n", ch);
+		ddr_init(DDR_BASE(ch));
+		retrained = true;
+	}
+
+	if (retrained)
+		ddr_train_seal();
+
+	return retrained;
+}
+#endif /* PLAT_DDR_FAST_BOOT */
+
+#if PLAT_DDR_CONCURRENT_INIT
+/* Service the training firmware of both channels until both have finished */
+static void ddr_wait_training(void)
+{
+	bool done[DDR_NUM_CH] = { false };
+	uint32_t ch, left = DDR_NUM_CH;
+
+	while (left != 0U) {
+		for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+			if (done[ch])
+				continue;
+
+			ddr_select(DDR_BASE(ch));
+			if (dwc_ddrphy_phyinit_userCustom_G_pollDone()) {
+				done[ch] = true;
+				left--;
+			}
+		}
+	}
+}
+
+/*
+ * ddr_init() for both channels, interleaved: each long phase is started on
+ * every channel before waiting for any of them, so the 1D/2D training and the
+ * BIST clear of the two channels overlap.
+ */
+static void ddr_init_concurrent(void)
+{
+	uint32_t bak_lp_auto_entry_en[DDR_NUM_CH];
+	uint32_t ch;
+
+	for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+		ddr_ctl_setup(DDR_BASE(ch));
+		phyinit_c();
+		phyinit_load_1d_image();
+		phyinit_start_1d_image();
+	}
+	ddr_wait_training();
+
+	for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+		ddr_select(DDR_BASE(ch));
+		phyinit_end_1d_image();
+		phyinit_load_2d_image();
+		phyinit_start_2d_image();
+	}
+	ddr_wait_training();
+
+	for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+		ddr_select(DDR_BASE(ch));
+		phyinit_end_2d_image();
+		phyinit_mc();
+		save_retcsr(DDR_BASE(ch));
+		phyinit_i();
+		phyinit_j();
+		bak_lp_auto_entry_en[ch] = prog_all0_start(DDR_BASE(ch), 33);
+	}
+
+	for (ch = 0U; ch < DDR_NUM_CH; ch++) {
+		ddr_select(DDR_BASE(ch));
+		prog_all0_end(bak_lp_auto_entry_en[ch]);
+		update_mc();
+	}
+}
+#endif /* PLAT_DDR_CONCURRENT_INIT */
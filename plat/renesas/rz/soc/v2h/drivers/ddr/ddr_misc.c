@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <arch_helpers.h>
@@ -79,29 +80,33 @@ void ddrtop_mc_param_poll(uint32_t addr, uint32_t offset, uint32_t width, uint32
 	ddrtop_mc_apb_poll(addr, tmp_data, tmp_mask);
 }
 
-void dwc_ddrphy_phyinit_userCustom_G_waitDone(uint8_t sel_train)
+/*
+ * Service the pending mailbox message of the training firmware, if there is
+ * one. Returns true once the firmware has reported the end of training.
+ */
+bool dwc_ddrphy_phyinit_userCustom_G_pollDone(void)
 {
-	uint32_t train_done = 0;
 	uint32_t mail;
 
-	do {
-		/* Wait at least 500 cycles */
-		uint32_t data = dwc_ddrphy_apb_rd(0x0d0004);
-
-		if ((data & 0x1) == 0) {
-			mail = get_mail(0);
-			if (mail == 0xff || mail == 0x07) {
-				train_done = 1;
-			} else if (mail == 0x08) {
-				decode_streaming_message();
-			}
-		}
-	} while (train_done == 0);
+	if ((dwc_ddrphy_apb_rd(0x0d0004) & 0x1) != 0)
+		return false;
 
-	if (mail == 0xff) {
+	mail = get_mail(0);
+	if (mail == 0x08) {
+		decode_streaming_message();
+	} else if (mail == 0xff) {
 		ERROR("Training failed.\n");
 		panic();
 	}
+
+	return mail == 0x07;
+}
+
+void dwc_ddrphy_phyinit_userCustom_G_waitDone(uint8_t sel_train)
+{
+	/* Wait at least 500 cycles */
+	while (!dwc_ddrphy_phyinit_userCustom_G_pollDone())
+		;
 }
 
 uint32_t get_mail(uint8_t mode_32bits)
@@ -7,6 +7,7 @@
 #ifndef __DDR_PRIVATE_H__
 #define __DDR_PRIVATE_H__
 
+#include <stdbool.h>
 #include <lib/mmio.h>
 
 #include "ddr_regs.h"
@@ -55,6 +56,7 @@ extern void ddrtop_proc_error(void);
 
 extern uint32_t get_mail(uint8_t mode_32bits);
 extern void dwc_ddrphy_phyinit_userCustom_G_waitDone(uint8_t sel_train);
+extern bool dwc_ddrphy_phyinit_userCustom_G_pollDone(void);
 
 /* DDR setup MC funcion */
 extern void setup_mc(void);
@@ -65,8 +67,15 @@ extern void phyinit_configuration(void);
 extern void phyinit_pin_swizzling(void);
 extern void phyinit_load_1d_image(void);
 extern void phyinit_exec_1d_image(void);
+extern void phyinit_start_1d_image(void);
+extern void phyinit_end_1d_image(void);
 extern void phyinit_load_2d_image(void);
 extern void phyinit_exec_2d_image(void);
+extern void phyinit_start_2d_image(void);
+extern void phyinit_end_2d_image(void);
 extern void phyinit_load_eng_image(void);
 
+/* CRC of all DDR parameter tables */
+extern uint32_t ddr_param_crc(void);
+
 #endif /* __DDR_PRIVATE_H__ */
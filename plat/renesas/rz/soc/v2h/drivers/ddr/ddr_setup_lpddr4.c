@@ -6,43 +6,127 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#if PLAT_DDR_FAST_BOOT
+#include <common/tf_crc32.h>
+#endif
 #include "ddr_regs.h"
 #include "ddr_private.h"
 
 
-extern const uint32_t param_phyinit_swizzle[][2];
-extern const uint32_t param_phyinit_c[][2];
-extern const uint32_t param_phyinit_i[][2];
-extern const uint32_t phyinit_1d[];
-extern const uint32_t phyinit_2d[];
-extern const uint32_t param_phyinit_f_1d_0[][2];
-extern const uint32_t param_phyinit_f_2d_0[][2];
-extern const uint32_t param_setup_mc[][2];
-
-extern const uint32_t param_phyinit_swizzle_size;
-extern const uint32_t param_phyinit_c_size;
-extern const uint32_t param_phyinit_i_size;
-extern const uint32_t phyinit_1d_size;
-extern const uint32_t phyinit_2d_size;
-extern const uint32_t param_phyinit_f_1d_0_size;
-extern const uint32_t param_phyinit_f_2d_0_size;
-
-extern const uint32_t param_setup_mc_size;
+/*
+ * The parameter tables are packed at build time by
+ * tools/renesas/rz_ddr_pack/rz_ddr_pack.py, which documents the format.
+ */
+#define DDR_PACK_LIST		0U
+#define DDR_PACK_FILL		1U
+#define DDR_PACK_U16		2U
+
+extern const uint8_t param_phyinit_swizzle_pack[];
+extern const uint8_t param_phyinit_c_pack[];
+extern const uint8_t param_phyinit_i_pack[];
+extern const uint8_t phyinit_1d_pack[];
+extern const uint8_t phyinit_2d_pack[];
+extern const uint8_t param_phyinit_f_1d_0_pack[];
+extern const uint8_t param_phyinit_f_2d_0_pack[];
+extern const uint8_t param_setup_mc_pack[];
+
+extern const uint32_t param_phyinit_swizzle_pack_size;
+extern const uint32_t param_phyinit_c_pack_size;
+extern const uint32_t param_phyinit_i_pack_size;
+extern const uint32_t phyinit_1d_pack_size;
+extern const uint32_t phyinit_2d_pack_size;
+extern const uint32_t param_phyinit_f_1d_0_pack_size;
+extern const uint32_t param_phyinit_f_2d_0_pack_size;
+
+extern const uint32_t param_setup_mc_pack_size;
 
 
 static int8_t dwc_ddrphy_cdd_int(uint8_t val);
 static int8_t dwc_ddrphy_cdd_abs(uint8_t val);
 
+typedef void (*ddr_param_wr_t)(uint32_t addr, uint32_t data);
 
-void setup_mc(void)
+static uint32_t ddr_param_get(const uint8_t **pos)
+{
+	uint32_t val = 0;
+	uint32_t shift = 0;
+	uint8_t byte;
+
+	do {
+		byte = *(*pos)++;
+		val |= (uint32_t)(byte & 0x7f) << shift;
+		shift += 7;
+	} while (byte & 0x80);
+
+	return val;
+}
+
+static int32_t ddr_param_sget(const uint8_t **pos)
 {
-	size_t i;
+	uint32_t val = ddr_param_get(pos);
+
+	return (val & 1) ? -(int32_t)(val >> 1) - 1 : (int32_t)(val >> 1);
+}
 
-	for (i = 0; i < param_setup_mc_size; i++) {
-		ddrtop_mc_apb_wr(param_setup_mc[i][0], param_setup_mc[i][1]);
+/* Stream a packed table into 'wr', offsetting every address by 'base' */
+static void ddr_param_unpack(const uint8_t *pos, uint32_t size, uint32_t base,
+			     ddr_param_wr_t wr)
+{
+	const uint8_t *end = pos + size;
+	uint32_t hdr, mode, count, addr, val = 0;
+	uint32_t next = 0;
+	int32_t stride;
+
+	while (pos < end) {
+		hdr = ddr_param_get(&pos);
+		mode = hdr & 3;
+		count = hdr >> 2;
+		addr = next + (uint32_t)ddr_param_sget(&pos);
+		stride = (count > 1) ? ddr_param_sget(&pos) : 1;
+
+		if (mode == DDR_PACK_FILL)
+			val = ddr_param_get(&pos);
+
+		while (count-- > 0) {
+			if (mode == DDR_PACK_LIST) {
+				val = ddr_param_get(&pos);
+			} else if (mode == DDR_PACK_U16) {
+				val = (uint32_t)pos[0] | ((uint32_t)pos[1] << 8);
+				pos += 2;
+			}
+			wr(base + addr, val);
+			addr += (uint32_t)stride;
+		}
+		next = addr;
 	}
 }
 
+
+#if PLAT_DDR_FAST_BOOT
+uint32_t ddr_param_crc(void)
+{
+	uint32_t crc = 0U;
+
+	crc = tf_crc32(crc, param_setup_mc_pack, param_setup_mc_pack_size);
+	crc = tf_crc32(crc, param_phyinit_c_pack, param_phyinit_c_pack_size);
+	crc = tf_crc32(crc, param_phyinit_swizzle_pack,
+		       param_phyinit_swizzle_pack_size);
+	crc = tf_crc32(crc, phyinit_1d_pack, phyinit_1d_pack_size);
+	crc = tf_crc32(crc, param_phyinit_f_1d_0_pack,
+		       param_phyinit_f_1d_0_pack_size);
+	crc = tf_crc32(crc, phyinit_2d_pack, phyinit_2d_pack_size);
+	crc = tf_crc32(crc, param_phyinit_f_2d_0_pack,
+		       param_phyinit_f_2d_0_pack_size);
+	return tf_crc32(crc, param_phyinit_i_pack, param_phyinit_i_pack_size);
+}
+#endif /* PLAT_DDR_FAST_BOOT */
+
+void setup_mc(void)
+{
+	ddr_param_unpack(param_setup_mc_pack, param_setup_mc_pack_size, 0,
+			 ddrtop_mc_apb_wr);
+}
+
 void update_mc(void)
 {
 	ddrtop_mc_param_wr(INT_MASK_MASTER_ADDR, INT_MASK_MASTER_OFFSET+31, 1, 0);
@@ -57,60 +141,63 @@ void update_mc(void)
 
 void phyinit_configuration(void)
 {
-	size_t i;
-
-	for (i = 0; i < param_phyinit_c_size; i++) {
-		dwc_ddrphy_apb_wr(param_phyinit_c[i][0], param_phyinit_c[i][1]);
-	}
+	ddr_param_unpack(param_phyinit_c_pack, param_phyinit_c_pack_size, 0,
+			 dwc_ddrphy_apb_wr);
 }
 
 void phyinit_pin_swizzling(void)
 {
-	size_t i;
-
-	for (i = 0; i < param_phyinit_swizzle_size; i++) {
-		dwc_ddrphy_apb_wr(param_phyinit_swizzle[i][0], param_phyinit_swizzle[i][1]);
-	}
+	ddr_param_unpack(param_phyinit_swizzle_pack, param_phyinit_swizzle_pack_size,
+			 0, dwc_ddrphy_apb_wr);
 }
 
 void phyinit_load_1d_image(void)
 {
-	size_t i;
-
 	dwc_ddrphy_apb_wr(0x020060, 0x2);
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x0);
 
-	for (i = 0x0; i <= 0x3fff; i++)	{
-		dwc_ddrphy_apb_wr((uint32_t)(0x50000+i), (uint32_t)(phyinit_1d[i]));
-	}
+	ddr_param_unpack(phyinit_1d_pack, phyinit_1d_pack_size, 0x50000,
+			 dwc_ddrphy_apb_wr);
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 
-	for (i = 0; i < param_phyinit_f_1d_0_size; i++) {
-		dwc_ddrphy_apb_wr(param_phyinit_f_1d_0[i][0], param_phyinit_f_1d_0[i][1]);
-	}
+	ddr_param_unpack(param_phyinit_f_1d_0_pack, param_phyinit_f_1d_0_pack_size,
+			 0, dwc_ddrphy_apb_wr);
 }
 
 void phyinit_exec_1d_image(void)
 {
-	uint32_t val, sel_train, num_rank;
-	int8_t val0, val1, cdd_rr, cdd_rw_abs, cdd_ww, cdd_ww_abs;
-	uint32_t r2r_adr, r2r_ofs, r2r_wid;
-	uint32_t r2w_adr, r2w_ofs, r2w_wid;
-	uint32_t w2r_adr, w2r_ofs, w2r_wid;
-	uint32_t w2w_adr, w2w_ofs, w2w_wid;
+	uint32_t val, sel_train;
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x0);
 	val = dwc_ddrphy_apb_rd(0x01005f);
 	sel_train = ((val & 0x700) == 0x100) ? 0 : 2;
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 
+	phyinit_start_1d_image();
+	dwc_ddrphy_phyinit_userCustom_G_waitDone(sel_train);
+	phyinit_end_1d_image();
+}
+
+/* Start the 1D training firmware, which then runs until it reports done */
+void phyinit_start_1d_image(void)
+{
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x9);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x1);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x0);
-	dwc_ddrphy_phyinit_userCustom_G_waitDone(sel_train);
+}
+
+void phyinit_end_1d_image(void)
+{
+	uint32_t val, num_rank;
+	int8_t val0, val1, cdd_rr, cdd_rw_abs, cdd_ww, cdd_ww_abs;
+	uint32_t r2r_adr, r2r_ofs, r2r_wid;
+	uint32_t r2w_adr, r2w_ofs, r2w_wid;
+	uint32_t w2r_adr, w2r_ofs, w2r_wid;
+	uint32_t w2w_adr, w2w_ofs, w2w_wid;
+
 	dwc_ddrphy_apb_wr(0x0d0099, 0x1);
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x0);
@@ -210,19 +297,15 @@ void phyinit_exec_1d_image(void)
 
 void phyinit_load_2d_image(void)
 {
-	size_t i;
-
 	dwc_ddrphy_apb_wr(0x0d0000, 0x0);
 
-	for (i = 0x0; i <= 0x3fff; i++) {
-		dwc_ddrphy_apb_wr((uint32_t)(0x50000 + i), (uint32_t)(phyinit_2d[i]));
-	}
+	ddr_param_unpack(phyinit_2d_pack, phyinit_2d_pack_size, 0x50000,
+			 dwc_ddrphy_apb_wr);
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 
-	for (i = 0; i < param_phyinit_f_2d_0_size; i++) {
-		dwc_ddrphy_apb_wr(param_phyinit_f_2d_0[i][0], param_phyinit_f_2d_0[i][1]);
-	}
+	ddr_param_unpack(param_phyinit_f_2d_0_pack, param_phyinit_f_2d_0_pack_size,
+			 0, dwc_ddrphy_apb_wr);
 }
 
 void phyinit_exec_2d_image(void)
@@ -234,11 +317,22 @@ void phyinit_exec_2d_image(void)
 	sel_train = ((val & 0x700) == 0x100) ? 1 : 3;
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 
+	phyinit_start_2d_image();
+	dwc_ddrphy_phyinit_userCustom_G_waitDone(sel_train);
+	phyinit_end_2d_image();
+}
+
+/* Start the 2D training firmware, which then runs until it reports done */
+void phyinit_start_2d_image(void)
+{
 	dwc_ddrphy_apb_wr(0x0d0000, 0x1);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x9);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x1);
 	dwc_ddrphy_apb_wr(0x0d0099, 0x0);
-	dwc_ddrphy_phyinit_userCustom_G_waitDone(sel_train);
+}
+
+void phyinit_end_2d_image(void)
+{
 	dwc_ddrphy_apb_wr(0x0d0099, 0x1);
 
 	dwc_ddrphy_apb_wr(0x0d0000, 0x0);
@@ -247,11 +341,8 @@ void phyinit_exec_2d_image(void)
 
 void phyinit_load_eng_image(void)
 {
-	size_t i;
-
-	for (i = 0; i < param_phyinit_i_size; i++) {
-		dwc_ddrphy_apb_wr(param_phyinit_i[i][0], param_phyinit_i[i][1]);
-	}
+	ddr_param_unpack(param_phyinit_i_pack, param_phyinit_i_pack_size, 0,
+			 dwc_ddrphy_apb_wr);
 }
 
 static int8_t dwc_ddrphy_cdd_int(uint8_t val)
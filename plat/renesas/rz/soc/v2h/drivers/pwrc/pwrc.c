@@ -4,16 +4,25 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <lib/mmio.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
 #include <plat/common/platform.h>
 #include <cpg.h>
+#include <cpg_regs.h>
 #include <ddr.h>
 #include <pwrc.h>
 #include <pwrc_board.h>
 #include <sys_regs.h>
 
+typedef struct {
+	uintptr_t reg;
+	uint32_t  preq_mask;
+	uint32_t  paccept_mask;
+	uint32_t  pstate_on_mask;
+} CPG_CORE_PWR;
+
 extern void pwrc_func_call_with_pmustack(uintptr_t jump, void *arg);
 
 void __attribute__ ((section(".sram")))
@@ -41,7 +50,7 @@ void __dead2 pwrc_suspend_to_ram(void)
 	panic();
 }
 
-void pwrc_setup(void)
+void pwrc_set_reset_vector(unsigned int coreid, uintptr_t ep)
 {
 	const uint32_t rval[PLATFORM_CORE_COUNT][2] = {
 		{ SYS_ACPU_CFG_RVAL0, SYS_ACPU_CFG_RVAH0 },
@@ -50,12 +59,68 @@ void pwrc_setup(void)
 		{ SYS_ACPU_CFG_RVAL3, SYS_ACPU_CFG_RVAH3 }
 	};
 
+	mmio_write_32(rval[coreid][1], (uint32_t)((ep >> 32) & 0xFF));
+	mmio_write_32(rval[coreid][0], (uint32_t)(ep & 0xFFFFFFFC));
+}
+
+void pwrc_setup(void)
+{
 	unsigned int i;
-	uint32_t rvah0 = (uint32_t)(((uintptr_t)&plat_secondary_reset >> 32) & 0xFF);
-	uint32_t rval0 = (uint32_t)((uintptr_t)&plat_secondary_reset & 0xFFFFFFFC);
 
-	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
-		mmio_write_32(rval[i][1], rvah0);
-		mmio_write_32(rval[i][0], rval0);
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++)
+		pwrc_set_reset_vector(i, (uintptr_t)&plat_secondary_reset);
+}
+
+/* Release a core from reset; it starts at its reset vector */
+void pwrc_cpu_on(unsigned int coreid)
+{
+	const CPG_CORE_PWR pch[PLATFORM_CORE_COUNT] = {
+		{ CPG_LP_CA55_CTL2, CPG_LP_CA55_CTL2_COREPREQ0, CPG_LP_CA55_CTL2_COREACCEPT0, CPG_LP_CA55_CTL2_CORESTATE0_ON_MASK },
+		{ CPG_LP_CA55_CTL2, CPG_LP_CA55_CTL2_COREPREQ1, CPG_LP_CA55_CTL2_COREACCEPT1, CPG_LP_CA55_CTL2_CORESTATE1_ON_MASK },
+		{ CPG_LP_CA55_CTL3, CPG_LP_CA55_CTL3_COREPREQ2, CPG_LP_CA55_CTL3_COREACCEPT2, CPG_LP_CA55_CTL3_CORESTATE2_ON_MASK },
+		{ CPG_LP_CA55_CTL3, CPG_LP_CA55_CTL3_COREPREQ3, CPG_LP_CA55_CTL3_COREACCEPT3, CPG_LP_CA55_CTL3_CORESTATE3_ON_MASK }
+	};
+
+	/* Check if in standby */
+	if ((mmio_read_32(CPG_LP_CTL1) & 0x1) == 0x1) {
+		mmio_write_32(pch[coreid].reg, pch[coreid].preq_mask);
+		while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != pch[coreid].paccept_mask)
+			;
+		mmio_write_32(pch[coreid].reg, 0x00000000);
+		while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != 0x0)
+			;
 	}
+
+	/* Assert PORESET */
+	mmio_write_32(CPG_RST_0, (0x00010000 << coreid));
+	while ((mmio_read_32(CPG_RSTMON_0) & (0x1 << coreid)) == 0x0)
+		;
+
+	/* Deassert PORESET and RERESET */
+	mmio_write_32(CPG_RST_0, (0x00110011 << coreid));
+	while ((mmio_read_32(CPG_RSTMON_0) & (0x1 << coreid)) != 0x0)
+		;
+
+	mmio_write_32(pch[coreid].reg, (pch[coreid].pstate_on_mask | pch[coreid].preq_mask));
+	while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != pch[coreid].paccept_mask)
+		;
+
+	mmio_write_32(pch[coreid].reg, pch[coreid].pstate_on_mask);
+	while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != 0x0)
+		;
+}
+
+/* Called on the core itself, which must then enter WFI */
+void pwrc_cpu_off(unsigned int coreid)
+{
+	/* Request transition to Cortex-A55 CoreX Sleep Mode */
+	mmio_write_32(CPG_LP_CTL1, (CPG_LP_CTL1_CA55SLEEP_REQ << coreid));
+
+	/* Enter the Cortex-A55 Sleep Mode */
+	mmio_write_32(CPG_LP_CTL1, mmio_read_32(CPG_LP_CTL1) | 0x00000001);
+
+	/* Issue Barrier instruction */
+	isb();
+	dsb();
+	dcsw_op_all(DCCISW);
 }
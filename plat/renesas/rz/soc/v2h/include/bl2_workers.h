@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BL2_WORKERS_H
+#define BL2_WORKERS_H
+
+/* Stack of each worker core */
+#define BL2_WORKER_STACK_SIZE		0x800
+
+#ifndef __ASSEMBLER__
+
+#include <platform_def.h>
+
+typedef void (*bl2_job_fn_t)(void *arg);
+
+#if PLAT_BL2_WORKERS
+
+/*
+ * Jobs go to an idle secondary core, or run on the calling core when all of
+ * them are busy. The secondary cores are released on the first submit and
+ * must be parked again before BL2 hands over to BL31.
+ */
+void bl2_workers_submit(bl2_job_fn_t fn, void *arg);
+void bl2_workers_wait(void);
+void bl2_workers_park(void);
+
+/* Number of cores that run jobs, the calling core included */
+static inline unsigned int bl2_workers_count(void)
+{
+	return PLATFORM_CORE_COUNT;
+}
+
+#else
+
+static inline void bl2_workers_submit(bl2_job_fn_t fn, void *arg)
+{
+	fn(arg);
+}
+
+static inline void bl2_workers_wait(void)
+{
+}
+
+static inline void bl2_workers_park(void)
+{
+}
+
+static inline unsigned int bl2_workers_count(void)
+{
+	return 1U;
+}
+
+#endif /* PLAT_BL2_WORKERS */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* BL2_WORKERS_H */
@@ -7,6 +7,8 @@
 #ifndef __PLAT_DDR_H__
 #define __PLAT_DDR_H__
 
+#include <stdbool.h>
+
 #define RET_CSR_SIZE		(0x400)
 extern uint32_t ddr_csr_table[RET_CSR_SIZE];
 
@@ -14,4 +16,12 @@ void ddr_setup(void);
 void ddr_retention_entry(void);
 void ddr_retention_exit(uint8_t base);
 
+#if PLAT_DDR_FAST_BOOT
+/* Training record kept in flash, see ddr_setup_fast() */
+#define DDR_TRAIN_SIZE		(0x1000)
+extern uint32_t ddr_train_table[DDR_TRAIN_SIZE / sizeof(uint32_t)];
+
+bool ddr_setup_fast(void);
+#endif /* PLAT_DDR_FAST_BOOT */
+
 #endif	/* __PLAT_DDR_H__ */
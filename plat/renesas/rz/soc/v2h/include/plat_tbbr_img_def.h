@@ -8,6 +8,7 @@
 #define PLAT_TBBR_IMG_DEF_H
 
 #define V2H_DDR_CONFIG_ID	(MAX_IMG_IDS_WITH_SPMDS + 0)
+#define V2H_DDR_TRAIN_ID	(MAX_IMG_IDS_WITH_SPMDS + 1)
 
 #ifdef MAX_NUMBER_IDS
 
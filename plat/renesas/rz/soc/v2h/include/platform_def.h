@@ -73,6 +73,13 @@
 #define BL33_BASE				UL(0x50000000)
 #define BL33_LIMIT				(BL33_BASE + 0x08000000)
 
+/* Scratch buffer compressed BL32/BL33 images are read to (PLAT_BL3x_COMPRESS) */
+#define PLAT_DECOMP_BUF_BASE	BL33_LIMIT
+#define PLAT_DECOMP_BUF_SIZE	UL(0x04000000)
+/* With PLAT_IMAGE_STREAM only its start is used, as input window and workspace */
+#define PLAT_DECOMP_WINDOW_SIZE	UL(0x00010000)
+#define PLAT_DECOMP_WORK_SIZE	UL(0x00010000)
+
 /*******************************************************************************
  * Platform specific page table and MMU setup constants
  ******************************************************************************/
@@ -7,7 +7,12 @@
 #ifndef PWRC_H
 #define PWRC_H
 
+#include <stdint.h>
+
 void pwrc_setup(void);
+void pwrc_set_reset_vector(unsigned int coreid, uintptr_t ep);
+void pwrc_cpu_on(unsigned int coreid);
+void pwrc_cpu_off(unsigned int coreid);
 void plat_secondary_reset(void);
 void pwrc_suspend_to_ram(void);
 
@@ -30,6 +30,7 @@
 #define RZV2H_TSU0_BASE				UL(0x11000000)
 #define RZV2H_TSU1_BASE				UL(0x11001000)
 #define RZV2H_XSPI_BASE				UL(0x11030000)
+#define RZV2H_DMAC0_BASE			UL(0x11400000)
 
 #define	RZV2H_I2C_8_BASE			UL(0x11C01000)
 #define RZV2H_SCIF_BASE				UL(0x11C01400)
@@ -98,6 +99,9 @@
 
 #define RZV2H_SPIROM_DDR_CFG_BASE	(RZV2H_SPIROM_FIP_BASE + RZV2H_FIP_SIZE_MAX + 0x00000001)
 #define RZV2H_DDR_CONFIG_MAX		UL(0x00001000)
+/* Trained DDR PHY state for fast cold boot, clear of the sectors above */
+#define RZV2H_SPIROM_DDR_TRAIN_BASE	(RZV2H_SPIROM_FIP_BASE + RZV2H_FIP_SIZE_MAX + 0x00002000)
+#define RZV2H_DDR_TRAIN_MAX			UL(0x00001000)
 
 #define RZV2H_SYC_INCK_HZ			UL(24000000)
 #define RZV2H_UART_INCK_HZ			UL(100000000)
@@ -114,6 +118,14 @@
 #define PARAMS_BASE					BL2_LIMIT
 #define PARAMS_SIZE					UL(0x1000)
 #define RZ_SOC_BOOTINFO_BASE		RZV2H_BOOTINFO_BASE
+/*
+ * Firmware log ring (PLAT_LOG_RING), in non-secure DRAM just below the BL31
+ * secure DRAM so that the OS can read it. Until DDR is up BL2 keeps the log
+ * in SRAM next to the BL31 parameters.
+ */
+#define RZ_LOG_RING_BASE			UL(0x43EFC000)
+#define RZ_LOG_RING_SIZE			UL(0x4000)
+#define RZ_LOG_RING_EARLY_BASE		(PARAMS_BASE + PARAMS_SIZE)
 #define BOOT_KIND_BASE				PARAMS_BASE
 
 #define RZ_SOC_SYC_BASE				RZV2H_SYC_BASE
@@ -133,6 +145,9 @@
 #define RZ_SOC_SPIROM_DDR_CFG_BASE	RZV2H_SPIROM_DDR_CFG_BASE
 #define RZ_SOC_SPIROM_DDR_CFG_SIZE	RZV2H_DDR_CONFIG_MAX
 
+#define RZ_SOC_SPIROM_DDR_TRAIN_BASE	RZV2H_SPIROM_DDR_TRAIN_BASE
+#define RZ_SOC_SPIROM_DDR_TRAIN_SIZE	RZV2H_DDR_TRAIN_MAX
+
 #define RZ_SOC_OTP_BASE_PRODUCTID	SYS_LSI_PRR						/* OTPPRODUCT */
 
 #define RZ_SOC_OTP_BASE_CHIPID		(RZV2H_OTP_BASE + 0x114C)		/* OTPCPID0 */
@@ -148,6 +163,8 @@
 #define MMC1_SD_BASE				RZV2H_SD1_BASE
 #define MMC2_SD_BASE				RZV2H_SD2_BASE
 
+#define RZ_SOC_DMAC_BASE			RZV2H_DMAC0_BASE
+
 #define SYS_PCIE_REG_OFFSET_START	UL(0x1000)						/* Offset corresponds to register SYS_PCIE_INTX_CH0 */
 #define SYS_PCIE_REG_OFFSET_END		UL(0x1054)						/* Offset corresponds to register SYS_PCIE_MODE_CH1 */
 
@@ -23,6 +23,19 @@
 
 uint32_t ddr_csr_table[RET_CSR_SIZE] __attribute__ ((aligned(8)));
 
+#if PLAT_DDR_FAST_BOOT
+uint32_t ddr_train_table[DDR_TRAIN_SIZE / sizeof(uint32_t)] __attribute__ ((aligned(8)));
+
+static image_info_t ddr_train_info = {
+	.h.type = (uint8_t)PARAM_IMAGE_BINARY,
+	.h.version = (uint8_t)VERSION_2,
+	.h.size = (uint16_t)sizeof(image_info_t),
+	.h.attr = 0,
+	.image_max_size = sizeof(ddr_train_table),
+	.image_base = (uintptr_t)&ddr_train_table
+};
+#endif /* PLAT_DDR_FAST_BOOT */
+
 #if PLAT_SYSTEM_SUSPEND
 image_info_t ddr_config_info = {
 	.h.type = (uint8_t)PARAM_IMAGE_BINARY,
@@ -32,15 +45,18 @@ image_info_t ddr_config_info = {
 	.image_max_size = sizeof(ddr_csr_table),
 	.image_base = (uintptr_t)&ddr_csr_table
 };
+#endif /* PLAT_SYSTEM_SUSPEND */
 
-int save_ddr_config(unsigned int image_id, image_info_t *image_data)
+#if (PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT)
+static int xfer_ddr_config(unsigned int image_id, image_info_t *image_data,
+			   bool save)
 {
 	uintptr_t dev_handle;
 	uintptr_t image_handle;
 	uintptr_t image_spec;
 	uintptr_t image_base;
 	size_t image_size;
-	size_t bytes_write;
+	size_t bytes_done;
 	int io_result;
 
 	assert(image_data != NULL);
@@ -62,8 +78,6 @@ int save_ddr_config(unsigned int image_id, image_info_t *image_data)
 		return io_result;
 	}
 
-	INFO("Saving DDR retantion info.\n");
-
 	io_result = io_size(image_handle, &image_size);
 	if ((io_result != 0) || (image_size == 0U)) {
 		WARN("Failed to determine the size of the image id=%u (%i)\n",
@@ -81,14 +95,16 @@ int save_ddr_config(unsigned int image_id, image_info_t *image_data)
 
 	image_data->image_size = (uint32_t)image_size;
 
-	io_result = io_write(image_handle, image_base, image_size, &bytes_write);
-	if ((io_result != 0) || (bytes_write < image_size)) {
-		WARN("Failed to save image id=%u (%i)\n", image_id, io_result);
+	if (save)
+		io_result = io_write(image_handle, image_base, image_size, &bytes_done);
+	else
+		io_result = io_read(image_handle, image_base, image_size, &bytes_done);
+	if ((io_result != 0) || (bytes_done < image_size)) {
+		WARN("Failed to %s image id=%u (%i)\n", save ? "save" : "read",
+			image_id, io_result);
 		goto exit;
 	}
 
-	INFO("DDR Retention Info saved.\n");
-
 exit:
 	(void)io_close(image_handle);
 
@@ -96,11 +112,58 @@ exit:
 
 	return io_result;
 }
+#endif /* PLAT_SYSTEM_SUSPEND || PLAT_DDR_FAST_BOOT */
+
+#if PLAT_DDR_FAST_BOOT
+/*
+ * Cold boot DDR setup from the training record in xSPI flash. The record is
+ * only kept when booting from xSPI; other boot modes always train.
+ */
+static void ddr_cold_setup(void)
+{
+	boot_mode_t boot_mode = sys_get_boot_mode();
+
+	if ((boot_mode != SYS_BOOT_MODE_SPI_1_8) &&
+	    (boot_mode != SYS_BOOT_MODE_SPI_3_3)) {
+		ddr_setup();
+		return;
+	}
+
+	if (xfer_ddr_config(V2H_DDR_TRAIN_ID, &ddr_train_info, false) != 0)
+		zeromem(ddr_train_table, sizeof(ddr_train_table));
+
+	if (!ddr_setup_fast())
+		return;
+
+	INFO("Saving DDR training record.\n");
+	if (xfer_ddr_config(V2H_DDR_TRAIN_ID, &ddr_train_info, true) != 0)
+		WARN("Failed to save DDR training record.\n");
+}
+#else
+static void ddr_cold_setup(void)
+{
+	ddr_setup();
+}
+#endif /* PLAT_DDR_FAST_BOOT */
+
+#if PLAT_SYSTEM_SUSPEND
+int save_ddr_config(unsigned int image_id, image_info_t *image_data)
+{
+	int io_result;
+
+	INFO("Saving DDR retantion info.\n");
+
+	io_result = xfer_ddr_config(image_id, image_data, true);
+	if (io_result == 0)
+		INFO("DDR Retention Info saved.\n");
+
+	return io_result;
+}
 
 void plat_ddr_setup(void)
 {
 	if (!sys_is_resume_reboot()) {
-		ddr_setup();
+		ddr_cold_setup();
 
 		if (save_ddr_config(V2H_DDR_CONFIG_ID, &ddr_config_info) != 0) {
 			ERROR("Failed to save DDR retention info.\n");
@@ -119,6 +182,6 @@ void plat_ddr_setup(void)
 #else
 void plat_ddr_setup(void)
 {
-	ddr_setup();
+	ddr_cold_setup();
 }
 #endif /* PLAT_SYSTEM_SUSPEND */
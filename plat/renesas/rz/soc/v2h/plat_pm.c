@@ -28,13 +28,6 @@
 #define CLUSTER_PWR_STATE(s)			((s)->pwr_domain_state[MPIDR_AFFLVL1])
 #define CORE_PWR_STATE(s)				((s)->pwr_domain_state[MPIDR_AFFLVL0])
 
-typedef struct {
-	uintptr_t reg;
-	uint32_t  preq_mask;
-	uint32_t  paccept_mask;
-	uint32_t  pstate_on_mask;
-} CPG_CORE_PWR;
-
 typedef struct {
 	unsigned long value __aligned(CACHE_WRITEBACK_GRANULE);
 } mailbox_t;
@@ -62,61 +55,19 @@ static void rzv2h_pwr_cpuoff(unsigned long mpidr)
 		panic();
 	}
 
-	/* Request transition to Cortex-A55 CoreX Sleep Mode */
-	mmio_write_32(CPG_LP_CTL1, (CPG_LP_CTL1_CA55SLEEP_REQ << coreid));
-
-	/* Enter the Cortex-A55 Sleep Mode */
-	mmio_write_32(CPG_LP_CTL1, mmio_read_32(CPG_LP_CTL1) | 0x00000001);
-
-	/* Issue Barrier instruction */
-	isb();
-	dsb();
-	dcsw_op_all(DCCISW);
+	pwrc_cpu_off(coreid);
 }
 
 static int rzv2h_pwr_domain_on(u_register_t mpidr)
 {
-	const CPG_CORE_PWR pch[PLATFORM_CORE_COUNT] = {
-		{ CPG_LP_CA55_CTL2, CPG_LP_CA55_CTL2_COREPREQ0, CPG_LP_CA55_CTL2_COREACCEPT0, CPG_LP_CA55_CTL2_CORESTATE0_ON_MASK },
-		{ CPG_LP_CA55_CTL2, CPG_LP_CA55_CTL2_COREPREQ1, CPG_LP_CA55_CTL2_COREACCEPT1, CPG_LP_CA55_CTL2_CORESTATE1_ON_MASK },
-		{ CPG_LP_CA55_CTL3, CPG_LP_CA55_CTL3_COREPREQ2, CPG_LP_CA55_CTL3_COREACCEPT2, CPG_LP_CA55_CTL3_CORESTATE2_ON_MASK },
-		{ CPG_LP_CA55_CTL3, CPG_LP_CA55_CTL3_COREPREQ3, CPG_LP_CA55_CTL3_COREACCEPT3, CPG_LP_CA55_CTL3_CORESTATE3_ON_MASK }
-	};
-
 	uint8_t coreid = MPIDR_AFFLVL1_VAL(mpidr);
 
 	if (coreid >= PLATFORM_CORE_COUNT)
 		return PSCI_E_INVALID_PARAMS;
 
-	/* Check if in standby */
-	if ((mmio_read_32(CPG_LP_CTL1) & 0x1) == 0x1) {
-		mmio_write_32(pch[coreid].reg, pch[coreid].preq_mask);
-		while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != pch[coreid].paccept_mask)
-			;
-		mmio_write_32(pch[coreid].reg, 0x00000000);
-		while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != 0x0)
-			;
-	}
-
 	rz_program_trusted_mailbox(mpidr, gp_warm_ep);
 
-	/* Assert PORESET */
-	mmio_write_32(CPG_RST_0, (0x00010000 << coreid));
-	while ((mmio_read_32(CPG_RSTMON_0) & (0x1 << coreid)) == 0x0)
-		;
-
-	/* Deassert PORESET and RERESET */
-	mmio_write_32(CPG_RST_0, (0x00110011 << coreid));
-	while ((mmio_read_32(CPG_RSTMON_0) & (0x1 << coreid)) != 0x0)
-		;
-
-	mmio_write_32(pch[coreid].reg, (pch[coreid].pstate_on_mask | pch[coreid].preq_mask));
-	while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != pch[coreid].paccept_mask)
-		;
-
-	mmio_write_32(pch[coreid].reg, pch[coreid].pstate_on_mask);
-	while ((mmio_read_32(pch[coreid].reg) & pch[coreid].paccept_mask) != 0x0)
-		;
+	pwrc_cpu_on(coreid);
 
 	return PSCI_E_SUCCESS;
 }
@@ -15,6 +15,17 @@ DDR_SOURCES	+=				plat/renesas/rz/soc/v2h/drivers/ddr/ddr.c	\
 							plat/renesas/rz/soc/v2h/drivers/ddr/ddr_misc.c	\
 							plat/renesas/rz/soc/v2h/plat_ddr_setup.c
 
+# The DDR parameter tables are built from a packed copy generated at build time
+RZ_DDR_PACK			?=	tools/renesas/rz_ddr_pack/rz_ddr_pack.py
+DDR_PARAM_SOURCE	:=	$(filter %/ddr_param_def_lpddr4.c,${DDR_SOURCES})
+DDR_PARAM_PACKED	:=	${BUILD_PLAT}/$(notdir $(DDR_PARAM_SOURCE:.c=_pack.c))
+DDR_SOURCES			:=	$(filter-out ${DDR_PARAM_SOURCE},${DDR_SOURCES})	\
+							${DDR_PARAM_PACKED}
+
+${DDR_PARAM_PACKED}: ${DDR_PARAM_SOURCE} ${RZ_DDR_PACK} | ${BUILD_PLAT}
+	@echo "  PACK    $@"
+	${Q}${PYTHON} ${RZ_DDR_PACK} -D PLAT_DDR_ECC=${PLAT_DDR_ECC} $< $@
+
 PLAT_BL_COMMON_SOURCES	+=	plat/renesas/rz/soc/v2h/plat_security.c		\
 							plat/renesas/rz/soc/v2h/drivers/riic.c		\
 							plat/renesas/rz/soc/v2h/drivers/cpg.c		\
@@ -26,6 +37,11 @@ BL2_SOURCES				+=	plat/renesas/rz/soc/v2h/bl2_plat_setup.c		\
 							plat/renesas/rz/soc/v2h/drivers/sys.c			\
 							plat/renesas/rz/soc/v2h/drivers/pfc.c
 
+ifeq (${PLAT_BL2_WORKERS},1)
+BL2_SOURCES				+=	plat/renesas/rz/soc/v2h/bl2_workers.c			\
+							plat/renesas/rz/soc/v2h/bl2_workers_entry.S
+endif
+
 BL31_SOURCES			+=	plat/renesas/rz/soc/v2h/bl31_plat_setup.c		\
 							plat/renesas/rz/soc/v2h/plat_pm.c				\
 							plat/renesas/rz/soc/v2h/rz_plat_sip_handler.c
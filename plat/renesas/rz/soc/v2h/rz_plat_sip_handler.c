@@ -10,8 +10,10 @@
 #include <common/debug.h>
 #include <smccc_helpers.h>
 #include <arch_helpers.h>
+#include <platform_def.h>
 #include <rz_soc_def.h>
 #include <rz_sip_svc.h>
+#include <rz_boot_timeline.h>
 #include <sys_regs.h>
 
 
@@ -75,6 +77,28 @@ static uintptr_t rz_otp_handler_productid(void *handle)
 	SMC_RET1(handle, productid);
 }
 
+#if PLAT_BOOT_TIMELINE
+static uintptr_t rz_boot_timestamp_handler(void *handle, u_register_t x1)
+{
+	unsigned long long ts;
+
+	if ((x1 >= RZ_BOOT_TL_TOTAL_IDS) ||
+	    (rz_boot_timeline_get((unsigned int)x1, &ts) != 0)) {
+		WARN("%s: Invalid boot timestamp id\n", __func__);
+		SMC_RET1(handle, SMC_ARCH_CALL_INVAL_PARAM);
+	}
+
+	SMC_RET3(handle, SMC_OK, ts, read_cntfrq_el0());
+}
+#endif
+
+#if PLAT_LOG_RING
+static uintptr_t rz_log_ring_handler(void *handle)
+{
+	SMC_RET3(handle, SMC_OK, RZ_LOG_RING_BASE, RZ_LOG_RING_SIZE);
+}
+#endif
+
 uintptr_t rz_plat_sip_handler(uint32_t smc_fid,
 					u_register_t x1,
 					u_register_t x2,
@@ -93,6 +117,14 @@ uintptr_t rz_plat_sip_handler(uint32_t smc_fid,
 		return rz_sys_pcie_get_val(handle, x1);
 	case RZ_SIP_SVC_SET_SYSPCIE:
 		return rz_sys_pcie_set_val(handle, x1, x2);
+#if PLAT_BOOT_TIMELINE
+	case RZ_SIP_SVC_GET_BOOT_TIMESTAMP:
+		return rz_boot_timestamp_handler(handle, x1);
+#endif
+#if PLAT_LOG_RING
+	case RZ_SIP_SVC_GET_LOG_RING:
+		return rz_log_ring_handler(handle);
+#endif
 	default:
 		WARN("%s: Unimplemented RZ SiP Service Call: 0x%x\n", __func__, smc_fid);
 		SMC_RET1(handle, SMC_UNK);
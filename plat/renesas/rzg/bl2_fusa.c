@@ -6,8 +6,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <lib/mmio.h>
+#include <lib/utils.h>
 
 #if (RZG_DRAM_ECC == 1)
 #define MB(x)			((x) << 20)
@@ -52,6 +54,10 @@
 #endif
 
 extern void rcar_swdt_init_counter(void);
+#if (RZG_DRAM_ECC_CLEAR_DMA == 1)
+extern void rcar_dma_init(void);
+extern void rcar_dma_zero(uintptr_t dst, uint64_t len);
+#endif /* (RZG_DRAM_ECC_CLEAR_DMA == 1) */
 
 struct rzg2_ecc_conf {
 	uint32_t fusaareacr;
@@ -192,6 +198,11 @@ static const uint32_t adsplcr3 = 0;
 #endif /* (RCAR_LSI == RZ_G2M || RCAR_LSI == RZ_G2H) */
 
 #if ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL != 0))
+static uint64_t clear_bytes;
+static uint64_t clear_ticks;
+static const char *clear_engine;
+
+#if (RZG_DRAM_ECC_CLEAR_DMA == 0)
 /* Write zero-valued octa-byte words */
 static void bzero64(uintptr_t start, uint64_t size)
 {
@@ -202,6 +213,53 @@ static void bzero64(uintptr_t start, uint64_t size)
 	while (ptr < end)
 		*ptr++ = 0;
 }
+#endif /* (RZG_DRAM_ECC_CLEAR_DMA == 0) */
+
+/*
+ * Clear an ECC protected area so that its ECC codes become valid. With the
+ * MMU and D-Cache on (RCAR_BL2_DCACHE) whole cache lines are zeroed by
+ * DC ZVA and then cleaned to DRAM; DRAM is Device memory otherwise, so the
+ * SYS-DMAC fills it instead, falling back to CPU stores.
+ */
+static void ecc_clear(uintptr_t start, uint64_t size)
+{
+	uint64_t ticks = read_cntpct_el0();
+
+	if ((read_sctlr_el3() & (SCTLR_M_BIT | SCTLR_C_BIT)) ==
+	    (SCTLR_M_BIT | SCTLR_C_BIT)) {
+		clear_engine = "DC ZVA";
+		zero_normalmem((void *)start, size);
+		/* Write the zeroes back before the FuSa layout changes */
+		dcsw_op_all(DCCISW);
+	} else {
+#if (RZG_DRAM_ECC_CLEAR_DMA == 1)
+		clear_engine = "SYS-DMAC";
+		rcar_dma_zero(start, size);
+#else /* (RZG_DRAM_ECC_CLEAR_DMA == 1) */
+		clear_engine = "CPU";
+		bzero64(start, size);
+#endif /* (RZG_DRAM_ECC_CLEAR_DMA == 1) */
+	}
+
+	clear_ticks += read_cntpct_el0() - ticks;
+	clear_bytes += size;
+}
+
+static void ecc_clear_report(void)
+{
+	uint64_t mbps;
+
+	if ((clear_bytes == 0U) || (clear_ticks == 0U))
+		return;
+
+	/* Decimal MB/s, printed as GB/s */
+	mbps = (clear_bytes * read_cntfrq_el0()) / clear_ticks / 1000000U;
+	NOTICE("BL2: ECC areas cleared by %s, %u MB in %u ms (%u.%02u GB/s)\n",
+	       clear_engine, (unsigned int)(clear_bytes >> 20),
+	       (unsigned int)((clear_ticks * 1000U) / read_cntfrq_el0()),
+	       (unsigned int)(mbps / 1000U),
+	       (unsigned int)((mbps % 1000U) / 10U));
+}
 #endif /* ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL != 0)) */
 
 #if (RCAR_LSI == RZ_G2M || RCAR_LSI == RZ_G2H)
@@ -262,7 +320,7 @@ void bl2_ecc_dual_init(void)
 		 */
 		rcar_swdt_init_counter();
 		VERBOSE("\t\tClearing ECC area...\n");
-		bzero64((addr[i] ^ DRAM_XOR_ADDR), size[i]);
+		ecc_clear((addr[i] ^ DRAM_XOR_ADDR), size[i]);
 #endif /* ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL == 1)) */
 	}
 
@@ -283,7 +341,7 @@ void bl2_ecc_dual_init(void)
 		 */
 		rcar_swdt_init_counter();
 		VERBOSE("\t\tClearing FUSA area...\n");
-		bzero64(addr[i], size[i]);
+		ecc_clear(addr[i], size[i]);
 #endif /* ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL == 1)) */
 	}
 }
@@ -324,7 +382,7 @@ void bl2_ecc_single_init(const struct rzg2_ecc_conf *conf, int nb_of_conf)
 			rcar_swdt_init_counter();
 
 			VERBOSE("\t\tClearing ECC area...\n");
-			bzero64(ecc, MB((uint64_t)fusa_size >> size_shift));
+			ecc_clear(ecc, MB((uint64_t)fusa_size >> size_shift));
 #endif /* ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL == 2)) */
 		}
 
@@ -342,7 +400,7 @@ void bl2_ecc_single_init(const struct rzg2_ecc_conf *conf, int nb_of_conf)
 			rcar_swdt_init_counter();
 
 			VERBOSE("\t\tClearing FUSA area...\n");
-			bzero64(data, MB((uint64_t)fusa_size));
+			ecc_clear(data, MB((uint64_t)fusa_size));
 		}
 #endif /* ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL == 2)) */
 	}
@@ -355,6 +413,11 @@ void bl2_ecc_init(uint32_t major, uint32_t minor)
 #if (RZG_DRAM_ECC == 1)
 	int nb_of_conf = 0;
 
+#if ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL != 0) && \
+     (RZG_DRAM_ECC_CLEAR_DMA == 1))
+	rcar_dma_init();
+#endif
+
 #if (RCAR_LSI == RZ_G2E)
 	nb_of_conf = ARRAY_SIZE(rzg2_ek874_conf);
 	bl2_ecc_single_init(rzg2_ek874_conf, nb_of_conf);
@@ -372,10 +435,13 @@ void bl2_ecc_init(uint32_t major, uint32_t minor)
 	nb_of_conf = ARRAY_SIZE(rzg2_hihope_rzg2h_conf);
 	bl2_ecc_dual_init();
 	bl2_ecc_single_init(rzg2_hihope_rzg2h_conf, nb_of_conf);
-	return;
 #else
 #error "Don't have ECC initialize routine(unknown)."
 #endif
+
+#if ((FUSA_DRAM_CLEAR == 1) && (RZG_DRAM_ECC_FULL != 0))
+	ecc_clear_report();
+#endif
 #else  /* RZG_DRAM_ECC == 1 */
 	NOTICE("BL2: DRAM don't have ECC configuration\n");
 #endif /* RZG_DRAM_ECC == 1 */
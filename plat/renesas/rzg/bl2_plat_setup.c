@@ -112,6 +112,11 @@ static meminfo_t bl2_tzram_layout __aligned(CACHE_WRITEBACK_GRANULE);
 uint64_t fdt_blob[PAGE_SIZE_4KB / sizeof(uint64_t)];
 static void *fdt = (void *)fdt_blob;
 
+#if RCAR_BL2_DCACHE == 1
+/* PRR revision, kept for the DRAM ECC setup in bl2_el3_plat_arch_setup() */
+static uint32_t ecc_prr_major, ecc_prr_minor;
+#endif /* RCAR_BL2_DCACHE == 1 */
+
 static void unsigned_num_print(uint64_t unum, unsigned int radix, char *string)
 {
 	/* Just need enough space to store 64 bit decimal integer */
@@ -888,7 +893,13 @@ lcm_state:
 		rzg_qos_init();
 	}
 
+#if RCAR_BL2_DCACHE == 1
+	/* Deferred until the MMU is on, so that DC ZVA can clear the ECC areas */
+	ecc_prr_major = major;
+	ecc_prr_minor = minor;
+#else
 	bl2_ecc_init(major, minor);
+#endif /* RCAR_BL2_DCACHE == 1 */
 
 	/* Set up FDT */
 	ret = fdt_create_empty_tree(fdt, sizeof(fdt_blob));
@@ -991,6 +1002,8 @@ void bl2_el3_plat_arch_setup(void)
 			       , BL2_COHERENT_RAM_BASE, BL2_COHERENT_RAM_LIMIT
 #endif /* USE_COHERENT_MEM */
 	    );
+
+	bl2_ecc_init(ecc_prr_major, ecc_prr_minor);
 #endif /* RCAR_BL2_DCACHE == 1 */
 }
 
@@ -235,6 +235,14 @@ RZG_DRAM_ECC_FULL :=0
 endif
 $(eval $(call add_define,RZG_DRAM_ECC_FULL))
 
+# Process RZG_DRAM_ECC_CLEAR_DMA flag
+# 0 : ECC areas are cleared by CPU stores when the BL2 D-Cache is off
+# 1 : ECC areas are filled by SYS-DMAC when the BL2 D-Cache is off
+ifndef RZG_DRAM_ECC_CLEAR_DMA
+RZG_DRAM_ECC_CLEAR_DMA :=1
+endif
+$(eval $(call add_define,RZG_DRAM_ECC_CLEAR_DMA))
+
 # RZ/G2N and RZ/G2E do not support ECC Full mode dual channel.
 ifeq (${LSI}, $(filter ${LSI}, G2E G2N))
   ifeq (${RZG_DRAM_ECC_FULL},1)
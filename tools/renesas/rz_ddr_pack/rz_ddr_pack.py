@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Renesas Electronics Corporation. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Pack the RZ DDR parameter tables into compact byte streams.
+
+The input is a DDR parameter source such as ddr_param_def_lpddr4.c, made of
+'const uint32_t name[][2] = { {addr, value}, ... };' register tables and
+'const uint32_t name[] = { value, ... };' images (addressed from 0). Every
+table is emitted as 'const uint8_t name_pack[]' plus 'name_pack_size'.
+
+A stream is a list of records, each describing 'count' writes to
+'base + i * stride':
+
+    varint  (count << 2) | mode
+    svarint base - next     (next = address after the previous record)
+    svarint stride          (only when count > 1)
+    values                  (see below)
+
+With mode PACK_LIST each value is a varint, with PACK_FILL a single varint is
+written 'count' times and with PACK_U16 each value is a little-endian 16-bit
+word, which suits the PHY firmware images. varint is unsigned LEB128;
+svarint is a zigzag-encoded varint.
+"""
+
+import argparse
+import re
+import sys
+
+# Record modes, shared with the decoder in ddr_setup_lpddr4.c
+PACK_LIST = 0
+PACK_FILL = 1
+PACK_U16 = 2
+
+# Shortest constant-value span worth its own fill record
+FILL_MIN = 4
+
+TABLE_RE = re.compile(
+    r'const\s+uint32_t\s+(\w+)\s*\[\s*\]\s*(\[\s*2\s*\])?\s*=\s*\{(.*?)\};',
+    re.S)
+NUM_RE = re.compile(r'0[xX][0-9a-fA-F]+|\d+')
+
+
+def preprocess(text, defines):
+    """Resolve '#if NAME' / '#else' / '#endif' against 'defines'."""
+    out = []
+    stack = []
+    for line in text.splitlines():
+        tok = line.split()
+        if tok and tok[0] == '#if':
+            stack.append(defines.get(tok[1], 0) != 0)
+        elif tok and tok[0] == '#else':
+            stack[-1] = not stack[-1]
+        elif tok and tok[0] == '#endif':
+            stack.pop()
+        elif tok and tok[0].startswith('#'):
+            continue
+        elif all(stack):
+            out.append(line)
+    return '\n'.join(out)
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def varint(val):
+    out = bytearray()
+    while True:
+        byte = val & 0x7f
+        val >>= 7
+        if val:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return out
+
+
+def svarint(val):
+    return varint((val << 1) if val >= 0 else ((-val << 1) - 1))
+
+
+def record(base, stride, values, fill, nxt):
+    if len(values) == 1:
+        stride = 1
+
+    if fill:
+        mode, body = PACK_FILL, varint(values[0])
+    else:
+        mode, body = PACK_LIST, bytearray()
+        for val in values:
+            body += varint(val)
+        if max(values) <= 0xffff and len(values) * 2 < len(body):
+            mode, body = PACK_U16, bytearray()
+            for val in values:
+                body += bytes((val & 0xff, val >> 8))
+
+    out = varint((len(values) << 2) | mode)
+    out += svarint(base - nxt)
+    if len(values) > 1:
+        out += svarint(stride)
+    return out + body, base + len(values) * stride
+
+
+def pack(pairs):
+    out = bytearray()
+    nxt = 0
+    i = 0
+    while i < len(pairs):
+        # Longest run of addresses with a constant stride
+        j = i + 1
+        stride = 1
+        if j < len(pairs):
+            stride = pairs[j][0] - pairs[i][0]
+            while j < len(pairs) and \
+                    pairs[j][0] - pairs[j - 1][0] == stride:
+                j += 1
+
+        # Split the run into constant-value fills and plain lists
+        k = i
+        while k < j:
+            fill_end = k + 1
+            while fill_end < j and pairs[fill_end][1] == pairs[k][1]:
+                fill_end += 1
+            if fill_end - k >= FILL_MIN:
+                end, fill = fill_end, True
+            else:
+                end = k + 1
+                while end < j:
+                    run = end + 1
+                    while run < j and pairs[run][1] == pairs[end][1]:
+                        run += 1
+                    if run - end >= FILL_MIN:
+                        break
+                    end += 1
+                fill = False
+            rec, nxt = record(pairs[k][0], stride,
+                              [val for _, val in pairs[k:end]], fill, nxt)
+            out += rec
+            k = end
+        i = j
+    return bytes(out)
+
+
+def unpack(data):
+    """Reference decoder, used to check every stream before it is emitted."""
+    pos = 0
+
+    def get():
+        nonlocal pos
+        val = shift = 0
+        while True:
+            byte = data[pos]
+            pos += 1
+            val |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                return val
+
+    def sget():
+        val = get()
+        return -(val >> 1) - 1 if val & 1 else val >> 1
+
+    out = []
+    nxt = 0
+    while pos < len(data):
+        hdr = get()
+        count, mode = hdr >> 2, hdr & 3
+        base = nxt + sget()
+        stride = sget() if count > 1 else 1
+        val = get() if mode == PACK_FILL else None
+        for i in range(count):
+            if mode == PACK_LIST:
+                val = get()
+            elif mode == PACK_U16:
+                val = data[pos] | (data[pos + 1] << 8)
+                pos += 2
+            out.append((base + i * stride, val))
+        nxt = base + count * stride
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('-D', dest='defines', action='append', default=[],
+                        metavar='NAME=VAL', help='preprocessor define')
+    parser.add_argument('input', help='DDR parameter source')
+    parser.add_argument('output', help='packed C source to write')
+    args = parser.parse_args()
+
+    defines = {}
+    for define in args.defines:
+        name, _, val = define.partition('=')
+        defines[name] = int(val or '1', 0)
+
+    with open(args.input) as src:
+        text = preprocess(strip_comments(src.read()), defines)
+
+    lines = [
+        '/*',
+        ' * Generated by rz_ddr_pack.py from %s. Do not edit.' %
+        args.input.split('/')[-1],
+        ' */',
+        '',
+        '#include <stdint.h>',
+        '',
+    ]
+    raw_size = packed_size = 0
+    for match in TABLE_RE.finditer(text):
+        name, is_pairs, body = match.groups()
+        nums = [int(num, 0) for num in NUM_RE.findall(body)]
+        if is_pairs:
+            pairs = list(zip(nums[0::2], nums[1::2]))
+        else:
+            pairs = list(enumerate(nums))
+
+        data = pack(pairs)
+        if unpack(data) != pairs:
+            sys.exit('%s: %s does not round-trip' % (sys.argv[0], name))
+        raw_size += len(nums) * 4
+        packed_size += len(data)
+
+        lines.append('const uint8_t %s_pack[] = {' % name)
+        for off in range(0, len(data), 12):
+            lines.append('\t' + ' '.join('0x%02x,' % byte
+                                         for byte in data[off:off + 12]))
+        lines.append('};')
+        lines.append('const uint32_t %s_pack_size = sizeof(%s_pack);' %
+                     (name, name))
+        lines.append('')
+
+    lines.append('/* %u bytes of tables packed into %u */' %
+                 (raw_size, packed_size))
+    lines.append('')
+
+    with open(args.output, 'w') as dst:
+        dst.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()